@@ -0,0 +1,62 @@
+/**
+ * @author Ethan Okamura
+ * @file benchmark.cpp
+ * @brief times the BFS path search on a large random maze with the
+ *        ring-buffer Queue and with the linked LinkedQueue
+ */
+
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "pathfinder.h"
+
+// builds a random n x n maze in the input format (a wall bit per side)
+// every cell opens to the cell before it in x or in y, so the maze is a
+// tree and every cell is reachable
+std::vector<std::vector<int>> make_maze(int n, unsigned seed) {
+  std::vector<std::vector<int>> maze(n, std::vector<int>(n, 15));
+  std::mt19937 gen(seed);
+  for (int x = 0; x < n; x++) {
+    for (int y = 0; y < n; y++) {
+      bool up = x > 0 && (y == 0 || gen() % 2);
+      if (up) {
+        maze[x - 1][y] &= ~2;  // bottom wall of the cell above
+        maze[x][y] &= ~8;      // top wall
+      } else if (y > 0) {
+        maze[x][y - 1] &= ~1;  // right wall of the cell to the left
+        maze[x][y] &= ~4;      // left wall
+      }
+    }
+  }
+  return maze;
+}
+
+// returns the seconds taken by get_path() with QueueType
+template <typename QueueType>
+double time_path(PathFinder &path_finder, const char *name,
+                 std::size_t &length) {
+  std::clock_t time = std::clock();  // start
+  length = path_finder.get_path<QueueType>().size();
+  time = std::clock() - time;  // stop
+  double seconds = static_cast<double>(time) / CLOCKS_PER_SEC;
+  std::cout << name << ": " << seconds << " s (path of " << length
+            << " cells)\n";
+  return seconds;
+}
+
+// usage: benchmark [maze size]
+int main(int argc, char **argv) {
+  int n = argc > 1 ? std::atoi(argv[1]) : 4096;
+  std::cout << "--- BFS over a " << n << 'x' << n << " maze ---\n";
+  PathFinder path_finder(make_maze(n, 42), n);
+  std::size_t ring_length, linked_length;
+  double ring = time_path<Queue<int>>(path_finder, "Queue", ring_length);
+  double linked =
+      time_path<LinkedQueue<int>>(path_finder, "LinkedQueue", linked_length);
+  if (ring_length != linked_length || ring_length == 0) return EXIT_FAILURE;
+  std::cout << "Queue is " << linked / ring << "x faster\n";
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,38 @@
+#ifndef LINKED_QUEUE_H
+#define LINKED_QUEUE_H
+
+/**
+ * @author Ethan Okamura
+ * @file linked_queue.h
+ * @brief creates a simple queue class on a linked list!
+ *        (queue.h has the faster ring-buffer Queue)
+ */
+
+#include "linked_list.h"
+
+// Defines a queue that uses a doubly-linked list as a data structure.
+template <typename T>
+class LinkedQueue {
+ public:
+  // default constructor
+  LinkedQueue() : _ll{} {}
+  // list constructor
+  LinkedQueue(std::initializer_list<T> init_list) {
+    for (const T& val : init_list) this->_ll.push_back(val);
+  }
+  // pushes a string to the top of the stack
+  void push(T val) { this->_ll.push_back(val); }
+  // pops off the top value in the stack
+  void pop() { this->_ll.pop_front(); }
+  // returns the data at the top of the stack
+  T& front() const { return this->_ll.front(); }
+  // checks if the stack is empty (bool return value)
+  bool empty() const { return this->_ll.empty(); }
+  // returns the size of the stack
+  int size() const { return this->_ll.size(); }
+
+ private:
+  LinkedList<T> _ll;
+};
+
+#endif  // LINKED_QUEUE_H
@@ -26,8 +26,9 @@ PathFinder::~PathFinder() {
 }
 
 // find all adjacent nodes to the current node v
-std::vector<int> PathFinder::find_adj(int v) {
-  std::vector<int> adj;
+// writes them to adj and returns how many there are
+int PathFinder::find_adj(int v, int adj[4]) {
+  int count{0};
   int y{v / n};
   int x{v % n};
   int directions[8] = {0, 0, 1, -1, 1, -1, 0, 0};
@@ -35,12 +36,13 @@ std::vector<int> PathFinder::find_adj(int v) {
     int new_x{x + directions[i]};
     int new_y{y + directions[i + 4]};
     if (in_bounds(new_x, new_y) && is_connected(x, y, new_x, new_y))
-      adj.push_back(new_y * n + new_x);
+      adj[count++] = new_y * n + new_x;
   }
-  return adj;
+  return count;
 }
 
 // perform breadth-first search O(V + E)
+template <typename QueueType>
 void PathFinder::BFS(int s) {
 
   // create default values
@@ -50,7 +52,7 @@ void PathFinder::BFS(int s) {
     color[i] = 0;  // undiscovered
   }
 
-  Queue<int> q;
+  QueueType q;
 
   // initialization of the node we will search from (root)
   color[s] = 1;
@@ -61,8 +63,10 @@ void PathFinder::BFS(int s) {
   // main section O(E)
   while (!q.empty()) {
     int u = q.front();
-    std::vector<int> adj = find_adj(u);
-    for (const int &v : adj) {
+    int adj[4];
+    int count = find_adj(u, adj);
+    for (int i = 0; i < count; i++) {
+      int v = adj[i];
       if (color[v] == 0) {  // non-discovered node
         color[v] = 1;
         d[v] = d[u] + 1;
@@ -77,8 +81,9 @@ void PathFinder::BFS(int s) {
 }
 
 // find the shortest bath from the start node to end node
+template <typename QueueType>
 std::vector<int> PathFinder::find_path(int start, int end) {
-  BFS(start);
+  BFS<QueueType>(start);
   std::vector<int> path;
   // no path exists
   if (d[end] == -1) return path;
@@ -93,10 +98,15 @@ std::vector<int> PathFinder::find_path(int start, int end) {
 }
 
 // public wrapper to get the shortest path
+template <typename QueueType>
 std::vector<int> PathFinder::get_path() {
-  return (n > 0) ? find_path(k - 1, 0) : std::vector<int>();
+  return (n > 0) ? find_path<QueueType>(k - 1, 0) : std::vector<int>();
 }
 
+// the queue types get_path() is built for
+template std::vector<int> PathFinder::get_path<Queue<int>>();
+template std::vector<int> PathFinder::get_path<LinkedQueue<int>>();
+
 // check if there is a connection
 bool PathFinder::is_connected(int x1, int y1, int x2, int y2) const {
   int u{nodes[x1][y1]};
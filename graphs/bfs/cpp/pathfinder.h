@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <vector>
 
+#include "linked_queue.h"
 #include "queue.h"
 
 class PathFinder {
@@ -22,6 +23,8 @@ class PathFinder {
   // default destructor
   ~PathFinder();
   // public wrapper to find shortest path from (0,0) to (n-1,n-1)
+  // QueueType holds the BFS frontier (LinkedQueue<int> also works)
+  template <typename QueueType = Queue<int>>
   std::vector<int> get_path();
 
  private:
@@ -31,9 +34,11 @@ class PathFinder {
   int* d;              // distance from start
   int* color;          // color of each node
   std::vector<std::vector<int>> nodes;
+  template <typename QueueType>
   void BFS(int);
+  template <typename QueueType>
   std::vector<int> find_path(int, int);
-  std::vector<int> find_adj(int);
+  int find_adj(int, int[4]);
   bool is_connected(int, int, int, int) const;
   constexpr bool in_bounds(const int, const int);
 };
@@ -0,0 +1,360 @@
+/**
+ * @author Ethan Okamura
+ * @file ExternalSort.c
+ * @brief Implementation file for an external merge sort of lines: sorted
+ *        runs are spilled to temp files, then merged with a min heap
+ * @status: working / tested
+ */
+
+#define _DEFAULT_SOURCE  // getline(), mkstemp()
+
+#include "ExternalSort.h"
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include "LineSort.h"
+
+#define MERGE_FAN_IN 128          // most runs merged at once
+#define READ_BLOCK (1 << 16)      // most bytes read at once into a chunk
+#define MIN_RUN_BUFFER (1 << 12)  // smallest read or write buffer
+#define MAX_RUN_BUFFER (1 << 20)  // largest read buffer per run
+
+// Structs --------------------------------------------------------------------
+
+// the input file and the run files, shared by the workers under lock
+typedef struct Input {
+  pthread_mutex_t lock;
+  int fd;
+  bool eof;
+  char* carry;  // bytes read past the last line a worker took
+  size_t carryLength, carryCapacity;
+  size_t budget;       // bytes of lines per worker
+  size_t writeBuffer;  // bytes of each worker's write buffer
+  const char* tempDir;
+} Input;
+
+// one worker's lines
+typedef struct Chunk {
+  char* text;
+  size_t capacity;  // bytes of text, one more than it may fill
+  const char** lines;
+  size_t count, lineCapacity;
+} Chunk;
+
+// a run being merged, with its current line
+typedef struct Run {
+  FILE* file;
+  char* line;
+  size_t capacity;
+  ssize_t length;
+} Run;
+
+// Run files ------------------------------------------------------------------
+
+// paths of the run files that still exist, so a failure can remove them
+static char** runPaths = NULL;
+static size_t runCount = 0, runCapacity = 0;
+static pthread_mutex_t runLock = PTHREAD_MUTEX_INITIALIZER;
+
+// removes every run file left, at exit
+static void removeRuns(void) {
+  for (size_t i = 0; i < runCount; i++) {
+    if (runPaths[i] != NULL) unlink(runPaths[i]);
+    free(runPaths[i]);
+  }
+  free(runPaths);
+  runPaths = NULL;
+  runCount = runCapacity = 0;
+}
+
+// creates an empty run file in tempDir and returns it open for writing
+static FILE* newRun(const char* tempDir) {
+  size_t size = strlen(tempDir) + sizeof("/lex-run-XXXXXX");
+  char* path = malloc(size);
+  if (path == NULL) handleFailure("Failure to allocate memory for run");
+  snprintf(path, size, "%s/lex-run-XXXXXX", tempDir);
+  int fd = mkstemp(path);
+  if (fd < 0) handleFailure("Failure to create run file");
+  FILE* file = fdopen(fd, "w");
+  if (file == NULL) handleFailure("Failure to create run file");
+
+  pthread_mutex_lock(&runLock);
+  if (runCount == runCapacity) {
+    runCapacity = runCapacity > 0 ? 2 * runCapacity : 64;
+    runPaths = realloc(runPaths, runCapacity * sizeof(char*));
+    if (runPaths == NULL) handleFailure("Failure to allocate memory for run");
+  }
+  runPaths[runCount++] = path;
+  pthread_mutex_unlock(&runLock);
+  return file;
+}
+
+// closes a run file, failing if any write to it failed
+static void closeRun(FILE* file) {
+  if (fclose(file) != 0) handleFailure("Failure to write run file");
+}
+
+// Run generation -------------------------------------------------------------
+
+// adds line to chunk, growing its array
+static void addLine(Chunk* chunk, const char* line) {
+  if (chunk->count == chunk->lineCapacity) {
+    chunk->lineCapacity = chunk->lineCapacity > 0 ? 2 * chunk->lineCapacity
+                                                  : 1024;
+    chunk->lines =
+        realloc(chunk->lines, chunk->lineCapacity * sizeof(char*));
+    if (chunk->lines == NULL)
+      handleFailure("Failure to allocate memory for lines");
+  }
+  chunk->lines[chunk->count++] = line;
+}
+
+// Fills chunk with the next lines of the input that fit in the budget of
+// one worker, counting LINE_OVERHEAD per line, and returns the bytes they
+// take. Starts with the bytes carried over from the last call and carries
+// over the bytes after the last line it took. It never reads more than the
+// budget can take, so the rest of the text buffer is never touched.
+// Pre: input->lock is held.
+static size_t fillChunk(Input* input, Chunk* chunk) {
+  size_t length = input->carryLength, taken = 0;
+  if (chunk->capacity < length + 1) {
+    chunk->capacity = length + 1;
+    chunk->text = realloc(chunk->text, chunk->capacity);
+    if (chunk->text == NULL) handleFailure("Failure to allocate chunk");
+  }
+  char* text = chunk->text;
+  if (length > 0) memcpy(text, input->carry, length);
+  chunk->count = 0;
+  for (;;) {
+    // take the complete lines read so far, while they fit
+    char* newline;
+    while ((newline = memchr(text + taken, '\n', length - taken)) != NULL) {
+      size_t end = newline - text + 1;
+      if (chunk->count > 0 &&
+          end + LINE_OVERHEAD * (chunk->count + 1) > input->budget)
+        goto full;
+      addLine(chunk, text + taken);
+      taken = end;
+    }
+    if (input->eof) {
+      if (taken == length) break;
+      text[length++] = '\n';  // the last line had none
+      continue;
+    }
+    // read no more than the budget can still take, a block at a time, as
+    // each line taken shrinks it
+    size_t used = length + LINE_OVERHEAD * chunk->count;
+    size_t room = used < input->budget ? input->budget - used : 0;
+    if (room > READ_BLOCK) room = READ_BLOCK;
+    if (room > chunk->capacity - 1 - length)
+      room = chunk->capacity - 1 - length;
+    if (room == 0) {
+      if (chunk->count > 0) break;
+      // one line longer than the budget: read it whole
+      chunk->capacity *= 2;
+      chunk->text = text = realloc(text, chunk->capacity);
+      if (text == NULL) handleFailure("Failure to allocate chunk");
+      room = chunk->capacity - 1 - length;
+    }
+    ssize_t got = read(input->fd, text + length, room);
+    if (got < 0) handleFailure("Failure to read input file");
+    if (got == 0) input->eof = true;
+    length += got;
+  }
+full:
+  // lines point into text, which may have moved
+  input->carryLength = length - taken;
+  if (input->carryCapacity < input->carryLength) {
+    input->carryCapacity = input->carryLength;
+    input->carry = realloc(input->carry, input->carryCapacity);
+    if (input->carry == NULL) handleFailure("Failure to allocate carry");
+  }
+  if (input->carryLength > 0)
+    memcpy(input->carry, text + taken, input->carryLength);
+  return taken;
+}
+
+// A worker takes the next chunk of input under the lock, then sorts it and
+// writes it to a new run file without the lock, until the input runs out.
+// Its lines and its write buffer together fit in its share of the budget.
+static void* runWorker(void* arg) {
+  Input* input = arg;
+  Chunk chunk = {NULL, input->budget, NULL, 0, 0};
+  chunk.text = malloc(chunk.capacity);
+  char* buffer = malloc(input->writeBuffer);
+  if (chunk.text == NULL || buffer == NULL)
+    handleFailure("Failure to allocate chunk");
+  for (;;) {
+    pthread_mutex_lock(&input->lock);
+    size_t taken = fillChunk(input, &chunk);
+    pthread_mutex_unlock(&input->lock);
+    if (chunk.count == 0) break;
+
+    sortLines(chunk.lines, chunk.count);
+    FILE* run = newRun(input->tempDir);
+    setvbuf(run, NULL, _IONBF, 0);  // writeLines() does the buffering
+    writeLines(run, chunk.lines, chunk.count, chunk.text + taken, buffer,
+               input->writeBuffer);
+    closeRun(run);
+  }
+  free(chunk.text);
+  free(chunk.lines);
+  free(buffer);
+  return NULL;
+}
+
+// Merging --------------------------------------------------------------------
+
+// reads the next line of run; returns false at the end of the run
+static bool advance(Run* run) {
+  run->length = getline(&run->line, &run->capacity, run->file);
+  return run->length > 0;
+}
+
+// left child of index i
+static size_t left(size_t i) { return 2 * i + 1; }
+
+// right child of index i
+static size_t right(size_t i) { return 2 * i + 2; }
+
+// Compares the current lines of runs a and b like strcmp(), with memcmp()
+// over their shared length
+static int compareRuns(const Run* a, const Run* b) {
+  size_t lengthA = a->length - 1, lengthB = b->length - 1;  // without '\n'
+  int order = memcmp(a->line, b->line, lengthA < lengthB ? lengthA : lengthB);
+  if (order != 0) return order;
+  return (lengthA > lengthB) - (lengthA < lengthB);
+}
+
+// Restores the heap order of the runs in heap[0..size) below index i, with
+// the run whose current line is smallest at the root
+static void heapify(Run** heap, size_t size, size_t i) {
+  for (;;) {
+    size_t smallest = i;
+    if (left(i) < size &&
+        compareRuns(heap[left(i)], heap[smallest]) < 0)
+      smallest = left(i);
+    if (right(i) < size &&
+        compareRuns(heap[right(i)], heap[smallest]) < 0)
+      smallest = right(i);
+    if (smallest == i) return;
+    Run* tmp = heap[i];
+    heap[i] = heap[smallest];
+    heap[smallest] = tmp;
+    i = smallest;
+  }
+}
+
+// Returns the size of each of the k + 1 buffers of a merge of k runs within
+// memory bytes: one to read each run and one for the output.
+// Pre: k + 1 <= memory / MIN_RUN_BUFFER
+static size_t mergeBuffer(size_t k, size_t memory) {
+  size_t bufferSize = memory / (k + 1);
+  return bufferSize < MAX_RUN_BUFFER ? bufferSize : MAX_RUN_BUFFER;
+}
+
+// Merges the k sorted run files at paths into out with a min heap of their
+// current lines, reading each through a buffer of bufferSize bytes
+static void mergeRuns(char** paths, size_t k, FILE* out, size_t bufferSize) {
+  Run* runs = calloc(k, sizeof(Run));
+  Run** heap = malloc(k * sizeof(Run*));
+  char* buffers = malloc(k * bufferSize);
+  if (runs == NULL || heap == NULL || buffers == NULL)
+    handleFailure("Failure to allocate memory for merge");
+  size_t size = 0;
+  for (size_t i = 0; i < k; i++) {
+    runs[i].file = fopen(paths[i], "r");
+    if (runs[i].file == NULL) handleFailure("Failure to open run file");
+    setvbuf(runs[i].file, buffers + i * bufferSize, _IOFBF, bufferSize);
+    if (advance(&runs[i])) heap[size++] = &runs[i];
+  }
+  for (size_t i = size / 2; i-- > 0;) heapify(heap, size, i);
+
+  while (size > 0) {
+    Run* top = heap[0];
+    fwrite(top->line, 1, top->length, out);
+    if (!advance(top)) heap[0] = heap[--size];
+    heapify(heap, size, 0);
+  }
+
+  for (size_t i = 0; i < k; i++) {
+    if (ferror(runs[i].file)) handleFailure("Failure to read run file");
+    fclose(runs[i].file);
+    free(runs[i].line);
+  }
+  free(runs);
+  free(heap);
+  free(buffers);
+}
+
+// Sort -----------------------------------------------------------------------
+
+void externalSort(const char* inputFile, const char* outputFile, size_t memory,
+                  int threads, const char* tempDir) {
+  if (threads < 1) threads = 1;
+  // each worker's share holds its lines and a write buffer of an eighth of
+  // the share; a merge needs a buffer for each of two runs and the output
+  size_t share = memory / threads;
+  size_t writeBuffer = share / 8;
+  if (writeBuffer < MIN_RUN_BUFFER) writeBuffer = MIN_RUN_BUFFER;
+  if (writeBuffer > WRITE_BUFFER) writeBuffer = WRITE_BUFFER;
+  if (share < writeBuffer + MIN_RUN_BUFFER || memory < 3 * MIN_RUN_BUFFER)
+    handleFailure("Memory budget is too small!");
+  Input input = {PTHREAD_MUTEX_INITIALIZER, -1, false, NULL, 0, 0,
+                 share - writeBuffer, writeBuffer, tempDir};
+  input.fd = open(inputFile, O_RDONLY);
+  if (input.fd < 0) handleFailure("No file exists!");
+  atexit(removeRuns);
+
+  // sort runs in parallel
+  pthread_t* workers = malloc(threads * sizeof(pthread_t));
+  if (workers == NULL) handleFailure("Failure to allocate workers");
+  for (int i = 0; i < threads; i++)
+    if (pthread_create(&workers[i], NULL, runWorker, &input) != 0)
+      handleFailure("Failure to start worker");
+  for (int i = 0; i < threads; i++) pthread_join(workers[i], NULL);
+  free(workers);
+  close(input.fd);
+  free(input.carry);
+
+  // merge fanIn runs at a time into a new run, until one merge is left;
+  // runs[first..runCount) are still to be merged. The budget limits fanIn,
+  // so that every buffer of a merge gets at least MIN_RUN_BUFFER bytes
+  size_t fanIn = memory / MIN_RUN_BUFFER - 1;
+  if (fanIn > MERGE_FAN_IN) fanIn = MERGE_FAN_IN;
+  size_t first = 0;
+  while (runCount - first > fanIn) {
+    size_t bufferSize = mergeBuffer(fanIn, memory);
+    char* outBuffer = malloc(bufferSize);
+    if (outBuffer == NULL) handleFailure("Failure to allocate output buffer");
+    FILE* run = newRun(tempDir);
+    setvbuf(run, outBuffer, _IOFBF, bufferSize);
+    mergeRuns(runPaths + first, fanIn, run, bufferSize);
+    closeRun(run);
+    free(outBuffer);
+    for (size_t i = first; i < first + fanIn; i++) {
+      unlink(runPaths[i]);
+      free(runPaths[i]);
+      runPaths[i] = NULL;
+    }
+    first += fanIn;
+  }
+
+  size_t bufferSize = mergeBuffer(runCount - first, memory);
+  char* outBuffer = malloc(bufferSize);
+  if (outBuffer == NULL) handleFailure("Failure to allocate output buffer");
+  FILE* out = fopen(outputFile, "w");
+  if (out == NULL) handleFailure("No output file exists!");
+  setvbuf(out, outBuffer, _IOFBF, bufferSize);
+  mergeRuns(runPaths + first, runCount - first, out, bufferSize);
+  if (fclose(out) != 0) handleFailure("Failure to write output file");
+  free(outBuffer);
+  removeRuns();
+}
@@ -0,0 +1,21 @@
+/**
+ * @author Ethan Okamura
+ * @file ExternalSort.h
+ * @brief Header file for sorting the lines of a file larger than memory
+ * @status: working / tested
+ */
+
+#ifndef EXTERNAL_SORT_H_
+#define EXTERNAL_SORT_H_
+
+#include <stddef.h>
+
+// Sorts the lines of inputFile into outputFile in byte order, using about
+// memory bytes. threads workers each read a share of the budget worth of
+// lines, sort them and spill them to a run file in tempDir. The runs are
+// then merged, at most MERGE_FAN_IN at a time. A single line longer than a
+// worker's share is still read whole.
+void externalSort(const char* inputFile, const char* outputFile, size_t memory,
+                  int threads, const char* tempDir);
+
+#endif  // EXTERNAL_SORT_H_
@@ -1,119 +1,129 @@
 /**
  * @author Ethan Okamura
  * @file Lex.c
- * @brief Main file for List ADT. Performs insertion sort
+ * @brief Main file for Lex. Sorts the lines of a file in byte order, in
+ *        memory or, past a memory budget, with an external merge sort
  * @status: working / tested
  */
 
+#define _DEFAULT_SOURCE  // MAP_ANONYMOUS, madvise(), getopt()
+
+#include <fcntl.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-
-#include "List.h"
-
-#define MAX_STRING_LENGTH 100
-
-// Handle generic failures
-void handleFailure(const char* message) {
-  fprintf(stderr, "ERROR: %s\n", message);
-  exit(EXIT_FAILURE);
-}
-
-// Count the number of lines n in the input file.
-int getLineCount(const char* filename) {
-  FILE* file = fopen(filename, "r");
-  if (file == NULL) handleFailure("No file exists!");
-  int count = 0;
-  char buffer[MAX_STRING_LENGTH];
-  while (fgets(buffer, MAX_STRING_LENGTH, file)) {
-    count++;
-  }
-  fclose(file);
-  return count;
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ExternalSort.h"
+#include "LineSort.h"
+
+#define MAX_THREADS 8  // default limit on run workers
+
+// Maps filename into memory with one spare byte after it, and sets *size to
+// the file size. The spare byte lets a missing final '\n' be added without
+// copying: the file is mapped over an anonymous mapping one byte longer, and
+// both are private, so writing to it never touches the file.
+char* mapFile(const char* filename, size_t* size) {
+  int fd = open(filename, O_RDONLY);
+  if (fd < 0) handleFailure("No file exists!");
+  struct stat info;
+  if (fstat(fd, &info) < 0 || !S_ISREG(info.st_mode))
+    handleFailure("Input is not a regular file!");
+  *size = info.st_size;
+  char* text = mmap(NULL, *size + 1, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (text == MAP_FAILED) handleFailure("Failure to map input file");
+  if (*size > 0 &&
+      mmap(text, *size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd,
+           0) == MAP_FAILED)
+    handleFailure("Failure to map input file");
+  close(fd);
+  madvise(text, *size, MADV_WILLNEED);
+  return text;
 }
 
-// Create a string array of length n and read in the lines of the file as
-// strings, placing them into the array.
-char** readLines(const char* filename, int* n) {
-  FILE* file = fopen(filename, "r");
-  char** stringArray = (char**)malloc(*n * sizeof(char*));
-  if (stringArray == NULL || *n < 0 || file == NULL) {
-    fclose(file);
-    handleFailure("Failure to read lines");
-  }
-  // Read lines into the array
-  char buffer[MAX_STRING_LENGTH];
-  for (int i = 0; i < *n; i++) {
-    if (fgets(buffer, MAX_STRING_LENGTH, file)) {
-      // Remove trailing newline character
-      buffer[strcspn(buffer, "\n")] = '\0';
 
-      // Allocate memory for the string and copy it
-      stringArray[i] = (char*)malloc((strlen(buffer) + 1) * sizeof(char));
-      if (stringArray[i] == NULL) {
-        fclose(file);
-        handleFailure("Failure to allocate memory for string");
-      }
-      strcpy(stringArray[i], buffer);
-    }
+// Parses a byte count with an optional K, M or G suffix
+size_t parseSize(const char* text) {
+  char* suffix;
+  unsigned long long size = strtoull(text, &suffix, 10);
+  switch (*suffix) {
+    case 'G': size <<= 10;  // fall through
+    case 'M': size <<= 10;  // fall through
+    case 'K': size <<= 10; suffix++;
   }
-  fclose(file);
-  return stringArray;
+  if (suffix == text || *suffix != '\0' || size == 0)
+    handleFailure("Expected a memory size like 512M!");
+  return size;
 }
 
-// Inserts data into the Linked List using an insertion sort-like algorithm
-void insertionSort(List L, char* arr[], int size) {
-  append(L, 0);  // insert first element
-  for (int i = 1; i < size; i++) {
-    // move pointer to current index
-    moveBack(L);
-    while (index(L) >= 0 && strcmp(arr[get(L)], arr[i]) > 0) {
-      movePrev(L);  // move backwards until the correct spot is found
-    }
-    // check if it surpassed the front of the list
-    index(L) < 0 ? prepend(L, i) : insertAfter(L, i);
+// Sorts inputFile into outputFile in memory. With a budget, the output
+// buffer takes the place of the sort's scratch, which LINE_OVERHEAD counts
+// and which is freed by then.
+void sortInMemory(char* text, size_t size, const char** lines, size_t n,
+                  const char* outputFile, size_t memory) {
+  sortLines(lines, n);
+
+  // write sorted lines to output file
+  size_t bufferSize = WRITE_BUFFER;
+  if (memory > 0) {
+    size_t spare = memory - size - n * sizeof(char*);
+    if (bufferSize > spare) bufferSize = spare;
   }
+  char* buffer = malloc(bufferSize);
+  if (buffer == NULL) handleFailure("Failure to allocate output buffer");
+  FILE* file = fopen(outputFile, "w");
+  if (file == NULL) handleFailure("No output file exists!");
+  setvbuf(file, NULL, _IONBF, 0);  // writeLines() does the buffering
+  writeLines(file, lines, n, text + size + 1, buffer, bufferSize);
+  if (fclose(file) != 0) handleFailure("Failure to write output file");
+  free(buffer);
 }
 
-// Function to free the allocated string array
-void freeStringArray(char** arr, int n) {
-  for (int i = 0; i < n; i++) {
-    if (arr[i] != NULL) {
-      free(arr[i]);
+// usage: Lex [-m memory] [-j threads] [-T tempdir] input output
+// Without -m the whole input is sorted in memory. With -m, an input whose
+// lines do not fit in memory bytes is sorted with externalSort().
+int main(int argc, char** argv) {
+  size_t memory = 0;
+  long threads = sysconf(_SC_NPROCESSORS_ONLN);
+  if (threads < 1) threads = 1;
+  if (threads > MAX_THREADS) threads = MAX_THREADS;
+  const char* tempDir = getenv("TMPDIR") ? getenv("TMPDIR") : "/tmp";
+  int option;
+  while ((option = getopt(argc, argv, "m:j:T:")) != -1) {
+    switch (option) {
+      case 'm': memory = parseSize(optarg); break;
+      case 'j': threads = atol(optarg); break;
+      case 'T': tempDir = optarg; break;
+      default: handleFailure("Unknown option!");
     }
   }
-  free(arr);
-}
-
-int main(int argc, char** argv) {
-  if (argc != 3) handleFailure("Expected two arguements!");
-  char* inputFile = argv[1];
-  char* outputFile = argv[2];
-
-  // get number of lines
-  int n = getLineCount(inputFile);
-
-  // get strings for each line in the file
-  char** lines = readLines(inputFile, &n);
-
-  // init a new list
-  List list = newList();
-
-  // insertion sort - like insertion for List
-  insertionSort(list, lines, n);
-
-  // write sorted list to output file
-  FILE* file = fopen(outputFile, "w");
-  if (file == NULL) handleFailure("No output file exists!");
-  for (moveFront(list); index(list) >= 0; moveNext(list)) {
-    fprintf(file, "%s\n", lines[get(list)]);
+  if (argc - optind != 2) handleFailure("Expected two arguements!");
+  if (threads < 1) handleFailure("Expected at least one thread!");
+  char* inputFile = argv[optind];
+  char* outputFile = argv[optind + 1];
+
+  // an input larger than the budget cannot fit
+  struct stat info;
+  if (memory > 0 && (stat(inputFile, &info) < 0 || !S_ISREG(info.st_mode) ||
+                     (size_t)info.st_size > memory)) {
+    externalSort(inputFile, outputFile, memory, threads, tempDir);
+    return 0;
   }
 
-  // printList(file, list);
-  fclose(file);
+  // map the input and find its lines
+  size_t size, n;
+  char* text = mapFile(inputFile, &size);
+  const char** lines = splitLines(text, size, &n);
+  bool fits = memory == 0 || size + n * LINE_OVERHEAD <= memory;
+  if (fits) sortInMemory(text, size, lines, n, outputFile, memory);
 
   // free the allocated memory
-  freeList(&list);
-  freeStringArray(lines, n);
+  free(lines);
+  munmap(text, size + 1);
+  if (!fits) externalSort(inputFile, outputFile, memory, threads, tempDir);
   return 0;
 }
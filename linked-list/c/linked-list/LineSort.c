@@ -0,0 +1,194 @@
+/**
+ * @author Ethan Okamura
+ * @file LineSort.c
+ * @brief Implementation file for sorting lines in memory with an MSD radix
+ *        sort that hands small groups to multikey quicksort
+ * @status: working / tested
+ */
+
+#include "LineSort.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define RADIX_CUTOFF 1024       // smaller groups use multikey quicksort
+#define INSERTION_CUTOFF 16     // smaller groups use insertion sort
+
+// Handle generic failures
+void handleFailure(const char* message) {
+  fprintf(stderr, "ERROR: %s\n", message);
+  exit(EXIT_FAILURE);
+}
+
+// Returns the sort key of line[depth]: 0 at the end of the line, otherwise
+// the byte itself, with bytes below '\n' shifted up one to fill its place.
+// Keys therefore order lines exactly like strcmp() on the bytes, and fit in
+// one byte.
+static inline uint8_t keyAt(const char* line, size_t depth) {
+  uint8_t c = (uint8_t)line[depth];
+  return c == '\n' ? 0 : c < '\n' ? c + 1 : c;
+}
+
+const char** splitLines(char* text, size_t size, size_t* n) {
+  if (size > 0 && text[size - 1] != '\n') text[size++] = '\n';
+  size_t capacity = 1024;
+  const char** lines = malloc(capacity * sizeof(char*));
+  if (lines == NULL) handleFailure("Failure to allocate memory for lines");
+  size_t count = 0;
+  const char* end = text + size;
+  for (const char* line = text; line < end;) {
+    if (count == capacity) {
+      capacity *= 2;
+      lines = realloc(lines, capacity * sizeof(char*));
+      if (lines == NULL) handleFailure("Failure to allocate memory for lines");
+    }
+    lines[count++] = line;
+    line = (const char*)memchr(line, '\n', end - line) + 1;
+  }
+  *n = count;
+  return lines;
+}
+
+// Compares lines a and b from depth on, like strcmp()
+static int compareFrom(const char* a, const char* b, size_t depth) {
+  for (;; depth++) {
+    uint8_t ka = keyAt(a, depth), kb = keyAt(b, depth);
+    if (ka != kb) return ka - kb;
+    if (ka == 0) return 0;
+  }
+}
+
+// Sorts n lines that share their first depth bytes by insertion
+static void insertionSortLines(const char** a, size_t n, size_t depth) {
+  for (size_t i = 1; i < n; i++) {
+    const char* line = a[i];
+    size_t j = i;
+    for (; j > 0 && compareFrom(a[j - 1], line, depth) > 0; j--)
+      a[j] = a[j - 1];
+    a[j] = line;
+  }
+}
+
+static inline void swapLines(const char** a, size_t i, size_t j) {
+  const char* tmp = a[i];
+  a[i] = a[j];
+  a[j] = tmp;
+}
+
+// Sorts n lines that share their first depth bytes with multikey quicksort
+// (Bentley and Sedgewick): split by the key at depth into less, equal and
+// greater parts, then sort the equal part from depth + 1. It recurses on the
+// two smaller parts and loops on the largest, so the stack stays O(log n).
+static void multikeySort(const char** a, size_t n, size_t depth) {
+  while (n > INSERTION_CUTOFF) {
+    // median of three keys as the pivot
+    uint8_t k0 = keyAt(a[0], depth), k1 = keyAt(a[n / 2], depth),
+            k2 = keyAt(a[n - 1], depth);
+    uint8_t pivot = k0 < k1 ? (k1 < k2 ? k1 : k0 < k2 ? k2 : k0)
+                            : (k0 < k2 ? k0 : k1 < k2 ? k2 : k1);
+    // a[0..lt) < pivot, a[lt..i) == pivot, a[gt..n) > pivot
+    size_t lt = 0, i = 0, gt = n;
+    while (i < gt) {
+      uint8_t key = keyAt(a[i], depth);
+      if (key < pivot)
+        swapLines(a, lt++, i++);
+      else if (key > pivot)
+        swapLines(a, i, --gt);
+      else
+        i++;
+    }
+    size_t less = lt, equal = gt - lt, greater = n - gt;
+    // lines whose key is 0 have ended, so they are already equal
+    if (pivot == 0) equal = 0;
+    if (less >= equal && less >= greater) {
+      multikeySort(a + lt, equal, depth + 1);
+      multikeySort(a + gt, greater, depth);
+      n = less;
+    } else if (equal >= greater) {
+      multikeySort(a, less, depth);
+      multikeySort(a + gt, greater, depth);
+      a += lt;
+      n = equal;
+      depth++;
+    } else {
+      multikeySort(a, less, depth);
+      multikeySort(a + lt, equal, depth + 1);
+      a += gt;
+      n = greater;
+    }
+  }
+  insertionSortLines(a, n, depth);
+}
+
+// Sorts n lines that share their first depth bytes with an MSD radix sort:
+// the key at depth picks one of 256 buckets, and each bucket is sorted from
+// depth + 1. keys and aux are scratch space for n entries. Like
+// multikeySort() it loops on the largest bucket. A depth where every line
+// has the same key costs one counting pass, so long shared prefixes do not
+// recurse.
+static void radixSort(const char** a, const char** aux, uint8_t* keys,
+                      size_t n, size_t depth) {
+  while (n > RADIX_CUTOFF) {
+    size_t count[256] = {0};
+    for (size_t i = 0; i < n; i++) count[keys[i] = keyAt(a[i], depth)]++;
+    size_t start[256], largest = 1;
+    for (size_t k = 0, sum = 0; k < 256; k++) {
+      start[k] = sum;
+      sum += count[k];
+      if (k > 0 && count[k] > count[largest]) largest = k;
+    }
+    if (count[0] == n) return;  // every line has ended
+    if (count[largest] < n) {
+      size_t next[256];
+      memcpy(next, start, sizeof(next));
+      for (size_t i = 0; i < n; i++) aux[next[keys[i]]++] = a[i];
+      memcpy(a, aux, n * sizeof(char*));
+      // bucket 0 holds ended lines, which are equal
+      for (size_t k = 1; k < 256; k++)
+        if (k != largest && count[k] > 1)
+          radixSort(a + start[k], aux, keys, count[k], depth + 1);
+    }
+    a += start[largest];
+    n = count[largest];
+    depth++;
+  }
+  multikeySort(a, n, depth);
+}
+
+void sortLines(const char** lines, size_t n) {
+  if (n <= RADIX_CUTOFF) {
+    multikeySort(lines, n, 0);
+    return;
+  }
+  const char** aux = malloc(n * sizeof(char*));
+  uint8_t* keys = malloc(n);
+  if (aux == NULL || keys == NULL)
+    handleFailure("Failure to allocate memory for sorting");
+  radixSort(lines, aux, keys, n, 0);
+  free(aux);
+  free(keys);
+}
+
+// Lines are copied into the buffer, which is written with a single fwrite()
+// whenever it fills. The caller owns the buffer, so it can count it against
+// a memory budget.
+void writeLines(FILE* file, const char** lines, size_t n, const char* end,
+                char* buffer, size_t bufferSize) {
+  size_t used = 0;
+  for (size_t i = 0; i < n; i++) {
+    const char* line = lines[i];
+    size_t length = (const char*)memchr(line, '\n', end - line) + 1 - line;
+    if (used + length > bufferSize) {
+      fwrite(buffer, 1, used, file);
+      used = 0;
+      if (length > bufferSize) {
+        fwrite(line, 1, length, file);
+        continue;
+      }
+    }
+    memcpy(buffer + used, line, length);
+    used += length;
+  }
+  fwrite(buffer, 1, used, file);
+}
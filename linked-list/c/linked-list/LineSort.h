@@ -0,0 +1,39 @@
+/**
+ * @author Ethan Okamura
+ * @file LineSort.h
+ * @brief Header file for sorting the lines of a text buffer in memory
+ * @status: working / tested
+ */
+
+#ifndef LINE_SORT_H_
+#define LINE_SORT_H_
+
+#include <stddef.h>
+#include <stdio.h>
+
+// A line is a pointer to its first byte. Every line ends with '\n', which
+// is not part of its content, so no lengths are stored.
+
+// bytes that sortLines() needs per line, besides the line itself
+#define LINE_OVERHEAD (2 * sizeof(char*) + 1)
+
+// size of the buffer writeLines() is given when memory is not limited
+#define WRITE_BUFFER (1 << 20)
+
+// Prints message to stderr and exits.
+void handleFailure(const char* message);
+
+// Returns an array of pointers to the lines of text[0..size) in one pass,
+// and sets *n to their number. Adds a '\n' at text[size] if the last line
+// has none, so text[size] must be writable.
+const char** splitLines(char* text, size_t size, size_t* n);
+
+// Sorts the n lines in byte order.
+void sortLines(const char** lines, size_t n);
+
+// Writes the n lines, each with its '\n', to file, collecting them in
+// buffer[0..bufferSize) first. end bounds the buffer that holds the lines.
+void writeLines(FILE* file, const char** lines, size_t n, const char* end,
+                char* buffer, size_t bufferSize);
+
+#endif  // LINE_SORT_H_
@@ -38,6 +38,20 @@ typedef struct NodeObj {
   Node prev;
 } NodeObj;
 
+// Nodes in the first and largest pool blocks.
+#define MIN_POOL_BLOCK 16
+#define MAX_POOL_BLOCK 4096
+
+// private NodeBlock type: one malloc holding many nodes
+typedef struct NodeBlockObj* NodeBlock;
+
+// private NodeBlockObj type
+typedef struct NodeBlockObj {
+  NodeBlock next;
+  int size;
+  NodeObj nodes[];
+} NodeBlockObj;
+
 // ListObj type
 typedef struct ListObj {
   Node front;
@@ -45,16 +59,36 @@ typedef struct ListObj {
   Node cursor;
   int index;
   int length;
+  Node spare;        // deleted nodes, linked by next, reused before new ones
+  NodeBlock blocks;  // every block this List has allocated, newest first
 } ListObj;
 
 // Constructors-Destructors ---------------------------------------------------
 
 // newNode()
-// Returns reference to new Node object. Initializes next and data fields.
-Node newNode(ListElement data) {
-  Node N;
-  N = malloc(sizeof(NodeObj));
-  assert(N != NULL);
+// Returns reference to new Node object taken from L's spare nodes. When none
+// are left, allocates a block twice the size of the last one. Initializes
+// next and data fields.
+Node newNode(List L, ListElement data) {
+  if (L->spare == NULL) {
+    int size = MIN_POOL_BLOCK;
+    if (L->blocks != NULL && L->blocks->size < MAX_POOL_BLOCK) {
+      size = 2 * L->blocks->size;
+    } else if (L->blocks != NULL) {
+      size = MAX_POOL_BLOCK;
+    }
+    NodeBlock B = malloc(sizeof(NodeBlockObj) + size * sizeof(NodeObj));
+    assert(B != NULL);
+    B->next = L->blocks;
+    B->size = size;
+    L->blocks = B;
+    for (int i = 0; i < size; i++) {
+      B->nodes[i].next = L->spare;
+      L->spare = &B->nodes[i];
+    }
+  }
+  Node N = L->spare;
+  L->spare = N->next;
   N->data = data;
   N->next = NULL;
   N->prev = NULL;
@@ -62,10 +96,11 @@ Node newNode(ListElement data) {
 }
 
 // freeNode()
-// Frees heap memory pointed to by *pN, sets *pN to NULL.
-void freeNode(Node* pN) {
+// Returns *pN to L's spare nodes, sets *pN to NULL.
+void freeNode(List L, Node* pN) {
   if (pN != NULL && *pN != NULL) {
-    free(*pN);
+    (*pN)->next = L->spare;
+    L->spare = *pN;
     *pN = NULL;
   }
 }
@@ -80,6 +115,8 @@ List newList(void) {
   L->back = L->front = L->cursor = NULL;
   L->index = -1;
   L->length = 0;
+  L->spare = NULL;
+  L->blocks = NULL;
   return (L);
 }
 
@@ -87,8 +124,11 @@ List newList(void) {
 // *pL to NULL.
 void freeList(List* pL) {
   if (pL == NULL || *pL == NULL) return;
-  while (!isEmpty(*pL)) {
-    deleteFront(*pL);
+  NodeBlock B = (*pL)->blocks;
+  while (B != NULL) {
+    NodeBlock next = B->next;
+    free(B);
+    B = next;
   }
   free(*pL);
   *pL = NULL;
@@ -144,12 +184,16 @@ bool equals(List A, List B) {
 }
 
 // Manipulation procedures ----------------------------------------------------
-// Resets L to its original empty state.
+// Resets L to its original empty state. The nodes are kept for reuse.
 void clear(List L) {
   if (L == NULL) handleNullList("calling clear()");
-  while (!isEmpty(L)) {
-    deleteFront(L);
+  if (!isEmpty(L)) {
+    L->back->next = L->spare;
+    L->spare = L->front;
   }
+  L->front = L->back = L->cursor = NULL;
+  L->index = -1;
+  L->length = 0;
 }
 
 // Pre: length()>0, index()>=0
@@ -217,7 +261,7 @@ void moveNext(List L) {
 // insertion takes place before front element.
 void prepend(List L, ListElement x) {
   if (L == NULL) handleNullList("calling prepend()");
-  Node N = newNode(x);
+  Node N = newNode(L, x);
   if (isEmpty(L)) {
     L->front = L->back = N;
   } else {
@@ -233,7 +277,7 @@ void prepend(List L, ListElement x) {
 // insertion takes place after back element.
 void append(List L, ListElement x) {
   if (L == NULL) handleNullList("calling append()");
-  Node N = newNode(x);
+  Node N = newNode(L, x);
   if (isEmpty(L)) {
     L->front = L->back = N;
   } else {
@@ -250,7 +294,7 @@ void insertBefore(List L, ListElement x) {
   if (L == NULL) handleNullList("calling insertBefore()");
   if (isEmpty(L)) handleEmptyList("calling insertBefore()");
   if (index(L) < 0) handleEmptyList("calling insertBefore()");
-  Node n = newNode(x);
+  Node n = newNode(L, x);
   n->prev = L->cursor->prev;
   n->next = L->cursor;
   if (L->cursor->prev != NULL) {
@@ -269,7 +313,7 @@ void insertAfter(List L, ListElement x) {
   if (L == NULL) handleNullList("calling insertAfter()");
   if (isEmpty(L)) handleEmptyList("calling insertAfter()");
   if (index(L) < 0) handleEmptyList("calling insertAfter()");
-  Node n = newNode(x);
+  Node n = newNode(L, x);
   n->next = L->cursor->next;
   n->prev = L->cursor;
   if (L->cursor->next != NULL) {
@@ -299,7 +343,7 @@ void deleteFront(List L) {
   } else {
     L->front = L->back = NULL;
   }
-  freeNode(&N);
+  freeNode(L, &N);
   L->length--;
 }
 
@@ -318,7 +362,7 @@ void deleteBack(List L) {
   } else {
     L->back = L->front = NULL;
   }
-  freeNode(&N);
+  freeNode(L, &N);
   L->length--;
 }
 
@@ -341,7 +385,7 @@ void delete (List L) {
   N->next->prev = N->prev;
   L->cursor = NULL;
   L->index = -1;
-  freeNode(&N);
+  freeNode(L, &N);
   L->length--;
 }
 
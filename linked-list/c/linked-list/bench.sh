@@ -0,0 +1,21 @@
+#!/bin/bash
+# Times Lex on a sorted input and on a shuffled input, next to LC_ALL=C sort,
+# and checks that both give the same output.
+# Usage: ./bench.sh [sorted lines] [shuffled lines]
+make Lex
+
+SORTED_LINES=${1:-1000000}
+SHUFFLED_LINES=${2:-4000000}
+
+seq -f "word%08g" "$SORTED_LINES" > bench_sorted.txt
+seq -f "word%08g" "$SHUFFLED_LINES" | shuf --random-source=<(yes) > bench_shuffled.txt
+
+for INPUT_FILE in bench_sorted.txt bench_shuffled.txt; do
+  echo "Running Lex on $INPUT_FILE"
+  time ./Lex "$INPUT_FILE" bench_out.txt
+  echo "Running sort on $INPUT_FILE"
+  time LC_ALL=C sort "$INPUT_FILE" -o bench_sort.txt
+  cmp bench_out.txt bench_sort.txt || echo "Lex and sort disagree!"
+done
+
+make clean
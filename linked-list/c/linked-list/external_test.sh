@@ -0,0 +1,38 @@
+#!/bin/bash
+# Tests Lex's external merge sort on a generated file several times larger
+# than its memory budget. Each run must match LC_ALL=C sort and leave no run
+# files behind. Usage: ./external_test.sh [lines]
+make Lex
+
+LINES=${1:-400000}
+INPUT_FILE="external_in.txt"
+EXPECTED_OUTPUT="external_expected.txt"
+ACTUAL_OUTPUT="external_out.txt"
+TEMP_DIR=$(mktemp -d)
+FAILED=0
+
+# words of varied length and shared prefixes, plus empty lines and a last
+# line without '\n'
+seq -f "word%08g" "$LINES" | shuf --random-source=<(yes) |
+  awk '{ print substr($0, 1, 4 + NR % 9) (NR % 7 ? "" : "\t") (NR % 101 ? $0 : "") }' > "$INPUT_FILE"
+printf "no newline" >> "$INPUT_FILE"
+LC_ALL=C sort "$INPUT_FILE" > "$EXPECTED_OUTPUT"
+echo "Input is $(wc -c < "$INPUT_FILE") bytes"
+
+# budget, threads: a few runs, runs sorted in parallel, and more runs than
+# one merge takes, so they are merged in two passes
+for CASE in "1M 1" "1M 4" "64K 1"; do
+  set -- $CASE
+  echo "Running Lex -m $1 -j $2"
+  ./Lex -m "$1" -j "$2" -T "$TEMP_DIR" "$INPUT_FILE" "$ACTUAL_OUTPUT"
+  if cmp -s "$ACTUAL_OUTPUT" "$EXPECTED_OUTPUT" && [ -z "$(ls -A "$TEMP_DIR")" ]; then
+    echo "✅ Test passed: Output matches sort!"
+  else
+    echo "❌ Test failed: Differences found or run files left."
+    FAILED=1
+  fi
+done
+
+rm -rf "$TEMP_DIR" "$INPUT_FILE" "$EXPECTED_OUTPUT" "$ACTUAL_OUTPUT"
+make clean
+exit $FAILED
@@ -159,6 +159,50 @@ void Dequeue(Queue Q){
 }
 
 
+// EnqueueMany()
+// Places the n values data[0..n-1] at the back of Q, in order.
+// Pre: n>=0
+void EnqueueMany(Queue Q, const QueueElement* data, int n){
+   int i;
+
+   if( Q==NULL ){
+      fprintf(stderr, "Queue Error: calling EnqueueMany() on NULL Queue reference\n");
+      exit(EXIT_FAILURE);
+   }
+   if( n<0 ){
+      fprintf(stderr, "Queue Error: calling EnqueueMany() with n<0\n");
+      exit(EXIT_FAILURE);
+   }
+
+   for(i=0; i<n; i++){
+      Enqueue(Q, data[i]);
+   }
+}
+
+// DequeueMany()
+// Copies up to n values from the front of Q into out, in order, deletes
+// them from Q, and returns how many were copied.
+// Pre: n>=0
+int DequeueMany(Queue Q, QueueElement* out, int n){
+   int i;
+
+   if( Q==NULL ){
+      fprintf(stderr, "Queue Error: calling DequeueMany() on NULL Queue reference\n");
+      exit(EXIT_FAILURE);
+   }
+   if( n<0 ){
+      fprintf(stderr, "Queue Error: calling DequeueMany() with n<0\n");
+      exit(EXIT_FAILURE);
+   }
+
+   for(i=0; i<n && !isEmpty(Q); i++){
+      out[i] = Q->front->data;
+      Dequeue(Q);
+   }
+   return i;
+}
+
+
 // Other Functions ------------------------------------------------------------
 
 // printQueue()
@@ -7,11 +7,20 @@
 #include<stdbool.h>
 
 
-#define FORMAT "%d"  // format string for QueueElement
+// QueueElement is int unless the build picks another scalar type, e.g.
+//    gcc -DQUEUE_ELEMENT=double -DQUEUE_FORMAT='"%g"' ...
+#ifndef QUEUE_ELEMENT
+#define QUEUE_ELEMENT int
+#endif
+#ifndef QUEUE_FORMAT
+#define QUEUE_FORMAT "%d"
+#endif
+
+#define FORMAT QUEUE_FORMAT  // format string for QueueElement
 
 
 // Exported types -------------------------------------------------------------
-typedef int QueueElement;
+typedef QUEUE_ELEMENT QueueElement;
 typedef struct QueueObj* Queue;
 
 
@@ -53,6 +62,17 @@ void Enqueue(Queue Q, QueueElement data);
 // Pre: !isEmpty(Q)
 void Dequeue(Queue Q);
 
+// EnqueueMany()
+// Places the n values data[0..n-1] at the back of Q, in order.
+// Pre: n>=0
+void EnqueueMany(Queue Q, const QueueElement* data, int n);
+
+// DequeueMany()
+// Copies up to n values from the front of Q into out, in order, deletes
+// them from Q, and returns how many were copied.
+// Pre: n>=0
+int DequeueMany(Queue Q, QueueElement* out, int n);
+
 
 // Other Functions ------------------------------------------------------------
 
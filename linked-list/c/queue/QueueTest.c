@@ -1,15 +1,92 @@
 //-----------------------------------------------------------------------------
 // QueueTest.c
 // Another test client for Queue ADT
+//
+// QueueTest -b [n] [batch] times n values through a Queue instead, one at a
+// time and in batches.
 //-----------------------------------------------------------------------------
 #include<stdio.h>
 #include<stdlib.h>
 #include<stdbool.h>
+#include<string.h>
+#include<time.h>
 #include"Queue.h"
 
+// seconds()
+// Returns the processor time used since start, in seconds.
+double seconds(clock_t start){
+   return (double)(clock()-start)/CLOCKS_PER_SEC;
+}
+
+// benchmark()
+// Passes n values through a Queue three ways and prints millions of values
+// per second for each. Exits with failure if any value comes out wrong.
+void benchmark(int n, int batch){
+   int i, j, k;
+   clock_t start;
+   double sum = 0, expected = 0;
+   Queue Q = newQueue();
+   QueueElement* buffer = malloc(batch*sizeof(QueueElement));
+
+   for(i=0; i<n; i++) expected += (QueueElement)i;
+   printf("--- %d values, batches of %d, Mvalues/s ---\n", n, batch);
+
+   // grow to n values, then drain
+   start = clock();
+   for(i=0; i<n; i++){
+      Enqueue(Q, (QueueElement)i);
+   }
+   while( !isEmpty(Q) ){
+      sum += getFront(Q);
+      Dequeue(Q);
+   }
+   printf("Enqueue/Dequeue, full      %8.2f\n", n/seconds(start)/1e6);
+
+   // stay at about one batch of values
+   start = clock();
+   for(i=0; i<batch; i++){
+      Enqueue(Q, (QueueElement)i);
+   }
+   for(i=batch; i<n; i++){
+      sum += getFront(Q);
+      Dequeue(Q);
+      Enqueue(Q, (QueueElement)i);
+   }
+   while( !isEmpty(Q) ){
+      sum += getFront(Q);
+      Dequeue(Q);
+   }
+   printf("Enqueue/Dequeue, steady    %8.2f\n", n/seconds(start)/1e6);
+
+   // whole batches in, whole batches out
+   start = clock();
+   for(i=0; i<n; i+=batch){
+      k = (n-i<batch ? n-i : batch);
+      for(j=0; j<k; j++) buffer[j] = (QueueElement)(i+j);
+      EnqueueMany(Q, buffer, k);
+      k = DequeueMany(Q, buffer, batch);
+      for(j=0; j<k; j++) sum += buffer[j];
+   }
+   printf("EnqueueMany/DequeueMany    %8.2f\n", n/seconds(start)/1e6);
+
+   if( sum!=3*expected || !isEmpty(Q) ){
+      fprintf(stderr, "QueueTest: values lost or changed\n");
+      exit(EXIT_FAILURE);
+   }
+   free(buffer);
+   freeQueue(&Q);
+}
+
 int main(int argc, char* argv[]){
 
    int i;
+   QueueElement batch[8], out[8];
+
+   if( argc>1 && strcmp(argv[1], "-b")==0 ){
+      benchmark(argc>2 ? atoi(argv[2]) : 10000000, argc>3 ? atoi(argv[3]) : 256);
+      return(EXIT_SUCCESS);
+   }
+
    Queue Q = newQueue();
    Queue R = newQueue();
 
@@ -50,6 +127,17 @@ int main(int argc, char* argv[]){
    printQueue(R);
    printf("Q==R is %s\n\n", equals(Q, R)?"true":"false");
 
+   for(i=0; i<8; i++){
+      batch[i] = 21+i;
+   }
+   EnqueueMany(Q, batch, 8);
+   printQueue(Q);
+   printf("DequeueMany(Q, 3) gave %d\n", DequeueMany(Q, out, 3));
+   printf("DequeueMany(R, 8) gave %d\n", DequeueMany(R, out, 8));
+   printQueue(Q);
+   printQueue(R);
+   printf("\n");
+
    freeQueue(&Q);
    freeQueue(&R);
    return(EXIT_SUCCESS);
@@ -69,4 +157,10 @@ Q==R is true
 13 14 15 16 17 18 19 200
 Q==R is false
 
+13 14 15 16 17 18 19 20 21 22 23 24 25 26 27 28
+DequeueMany(Q, 3) gave 3
+DequeueMany(R, 8) gave 8
+16 17 18 19 20 21 22 23 24 25 26 27 28
+
+
 */
\ No newline at end of file
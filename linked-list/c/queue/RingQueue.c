@@ -0,0 +1,245 @@
+//-----------------------------------------------------------------------------
+// RingQueue.c
+// Ring buffer implementation file for Queue ADT. It exports the same
+// functions as Queue.c, so a client links with one or the other.
+//-----------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <stdbool.h>
+#include "Queue.h"
+
+#define MIN_CAPACITY 16  // first buffer size, always a power of 2
+
+
+// structs --------------------------------------------------------------------
+
+// private QueueObj type
+// The values sit in data[front], data[front+1], ... wrapping around at
+// capacity, which is a power of 2, so (i & (capacity-1)) is i mod capacity.
+typedef struct QueueObj{
+   QueueElement* data;
+   int capacity;
+   int front;
+   int length;
+} QueueObj;
+
+
+// Helpers --------------------------------------------------------------------
+
+// growQueue()
+// Moves the values of Q into a new buffer of at least n slots, starting at
+// index 0. The two runs of the old buffer are copied with memcpy.
+static void growQueue(Queue Q, int n){
+   int capacity = (Q->capacity>0 ? Q->capacity : MIN_CAPACITY);
+   while( capacity<n ){
+      capacity *= 2;
+   }
+   QueueElement* data = malloc(capacity*sizeof(QueueElement));
+   assert( data!=NULL );
+   int first = Q->capacity - Q->front;  // values before the wrap
+   if( first>Q->length ) first = Q->length;
+   if( first>0 ){
+      memcpy(data, Q->data+Q->front, first*sizeof(QueueElement));
+   }
+   if( Q->length>first ){
+      memcpy(data+first, Q->data, (Q->length-first)*sizeof(QueueElement));
+   }
+   free(Q->data);
+   Q->data = data;
+   Q->capacity = capacity;
+   Q->front = 0;
+}
+
+
+// Constructors-Destructors ---------------------------------------------------
+
+// newQueue()
+// Returns reference to new empty Queue object.
+Queue newQueue(){
+   Queue Q;
+   Q = malloc(sizeof(QueueObj));
+   assert( Q!=NULL );
+   Q->data = NULL;
+   Q->capacity = Q->front = Q->length = 0;
+   return(Q);
+}
+
+// freeQueue()
+// Frees all heap memory associated with Queue *pQ, and sets *pQ to NULL.
+void freeQueue(Queue* pQ){
+   if(pQ!=NULL && *pQ!=NULL) {
+      free((*pQ)->data);
+      free(*pQ);
+      *pQ = NULL;
+   }
+}
+
+
+// Access functions -----------------------------------------------------------
+
+// getFront()
+// Returns the value at the front of Q.
+// Pre: !isEmpty(Q)
+QueueElement getFront(Queue Q){
+   if( Q==NULL ){
+      fprintf(stderr, "Queue Error: calling getFront() on NULL Queue reference\n");
+      exit(EXIT_FAILURE);
+   }
+   if( isEmpty(Q) ){
+      fprintf(stderr, "Queue Error: calling getFront() on an empty Queue\n");
+      exit(EXIT_FAILURE);
+   }
+   return(Q->data[Q->front]);
+}
+
+// getLength()
+// Returns the length of Q.
+int getLength(Queue Q){
+   if( Q==NULL ){
+      fprintf(stderr, "Queue Error: calling getLength() on NULL Queue reference\n");
+      exit(EXIT_FAILURE);
+   }
+   return(Q->length);
+}
+
+// isEmpty()
+// Returns true if Q is empty, otherwise returns false.
+bool isEmpty(Queue Q){
+   if( Q==NULL ){
+      fprintf(stderr, "Queue Error: calling isEmpty() on NULL Queue reference\n");
+      exit(EXIT_FAILURE);
+   }
+   return(Q->length==0);
+}
+
+
+// Manipulation procedures ----------------------------------------------------
+
+// Enqueue()
+// Places new data at the back of Q.
+void Enqueue(Queue Q, QueueElement data)
+{
+   if( Q==NULL ){
+      fprintf(stderr, "Queue Error: calling Enqueue() on NULL Queue reference\n");
+      exit(EXIT_FAILURE);
+   }
+
+   if( Q->length==Q->capacity ){
+      growQueue(Q, Q->length+1);
+   }
+   Q->data[(Q->front+Q->length) & (Q->capacity-1)] = data;
+   Q->length++;
+}
+
+// Dequeue()
+// Deletes data at front of Q.
+// Pre: !isEmpty(Q)
+void Dequeue(Queue Q){
+   if( Q==NULL ){
+      fprintf(stderr, "Queue Error: calling Dequeue() on NULL Queue reference\n");
+      exit(EXIT_FAILURE);
+   }
+   if( isEmpty(Q) ){
+      fprintf(stderr, "Queue Error: calling Dequeue on an empty Queue\n");
+      exit(EXIT_FAILURE);
+   }
+
+   Q->front = (Q->front+1) & (Q->capacity-1);
+   Q->length--;
+}
+
+// EnqueueMany()
+// Places the n values data[0..n-1] at the back of Q, in order.
+// Pre: n>=0
+void EnqueueMany(Queue Q, const QueueElement* data, int n){
+   if( Q==NULL ){
+      fprintf(stderr, "Queue Error: calling EnqueueMany() on NULL Queue reference\n");
+      exit(EXIT_FAILURE);
+   }
+   if( n<0 ){
+      fprintf(stderr, "Queue Error: calling EnqueueMany() with n<0\n");
+      exit(EXIT_FAILURE);
+   }
+   if( n==0 ) return;
+
+   if( Q->length+n>Q->capacity ){
+      growQueue(Q, Q->length+n);
+   }
+   // at most two runs: up to the end of the buffer, then from its start
+   int back = (Q->front+Q->length) & (Q->capacity-1);
+   int first = Q->capacity - back;
+   if( first>n ) first = n;
+   memcpy(Q->data+back, data, first*sizeof(QueueElement));
+   if( n>first ){
+      memcpy(Q->data, data+first, (n-first)*sizeof(QueueElement));
+   }
+   Q->length += n;
+}
+
+// DequeueMany()
+// Copies up to n values from the front of Q into out, in order, deletes
+// them from Q, and returns how many were copied.
+// Pre: n>=0
+int DequeueMany(Queue Q, QueueElement* out, int n){
+   if( Q==NULL ){
+      fprintf(stderr, "Queue Error: calling DequeueMany() on NULL Queue reference\n");
+      exit(EXIT_FAILURE);
+   }
+   if( n<0 ){
+      fprintf(stderr, "Queue Error: calling DequeueMany() with n<0\n");
+      exit(EXIT_FAILURE);
+   }
+   if( n>Q->length ) n = Q->length;
+   if( n==0 ) return 0;
+
+   int first = Q->capacity - Q->front;
+   if( first>n ) first = n;
+   memcpy(out, Q->data+Q->front, first*sizeof(QueueElement));
+   if( n>first ){
+      memcpy(out+first, Q->data, (n-first)*sizeof(QueueElement));
+   }
+   Q->front = (Q->front+n) & (Q->capacity-1);
+   Q->length -= n;
+   return n;
+}
+
+
+// Other Functions ------------------------------------------------------------
+
+// printQueue()
+// Prints a string representation of Q consisting of a space separated list
+// of ints to stdout.
+void printQueue(Queue Q){
+   int i;
+
+   if( Q==NULL ){
+      fprintf(stderr, "Queue Error: calling printQueue() on NULL Queue reference\n");
+      exit(EXIT_FAILURE);
+   }
+
+   for(i=0; i<Q->length; i++){
+      printf(FORMAT" ", Q->data[(Q->front+i) & (Q->capacity-1)]);
+   }
+   printf("\n");
+}
+
+// equals()
+// Returns true if A is same int sequence as B, false otherwise.
+bool equals(Queue A, Queue B){
+   if( A==NULL || B==NULL ){
+      fprintf(stderr, "Queue Error: calling equals() on NULL Queue reference\n");
+      exit(EXIT_FAILURE);
+   }
+
+   bool eq;
+   int i;
+
+   eq = ( A->length == B->length );
+   for(i=0; eq && i<A->length; i++){
+      eq = ( A->data[(A->front+i) & (A->capacity-1)]
+             == B->data[(B->front+i) & (B->capacity-1)] );
+   }
+   return eq;
+}
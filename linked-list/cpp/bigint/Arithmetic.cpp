@@ -5,25 +5,11 @@
  *        operations on a BigInteger ADT
  */
 
-#include <array>
 #include <fstream>
 #include <stdexcept>
 
 #include "BigInteger.h"
-
-/// @brief Test cases enum to help consistency
-enum class Test {
-  TEST_1,
-  TEST_2,
-  TEST_3,
-  TEST_4,
-  TEST_5,
-  TEST_6,
-  TEST_7,
-  TEST_8,
-  TEST_9,
-  TEST_10
-};
+#include "Gauntlet.h"
 
 /**
  * @brief Generic function to handle failures.
@@ -34,49 +20,6 @@ int handle_failure(std::string message) {
   return EXIT_FAILURE;
 }
 
-/**
- * @brief Handles operations between 2 BigInts
- * @param A The first BigInt ADT.
- * @param B The second BigInt ADT.
- * @param code The operation code (from enum).
- */
-BigInteger arithmetic_gauntlet(const BigInteger &A, const BigInteger &B,
-                               Test code) {
-  BigInteger C(1);
-  BigInteger D(1);
-  switch (code) {
-    case Test::TEST_1:
-      return A;
-    case Test::TEST_2:
-      return B;
-    case Test::TEST_3:
-      return A + B;
-    case Test::TEST_4:
-      return A - B;
-    case Test::TEST_5:
-      return A - A;
-    case Test::TEST_6:
-      return (3 * A) - (2 * B);
-    case Test::TEST_7:
-      return A * B;
-    case Test::TEST_8:
-      return A * A;
-    case Test::TEST_9:
-      return B * B;
-    case Test::TEST_10:
-      for (int i = 0; i < 4; i++) {
-        C *= A;
-      }
-      for (int i = 0; i < 5; i++) {
-        D *= B;
-      }
-      return (9 * C) + (16 * D);
-    default:
-      // Basic error handling
-      throw std::logic_error("Arithmetic: Invalid test");
-  }
-}
-
 /**
  * @brief Handles operations between 2 BigInts
  * @param argc The number of arguements
@@ -108,12 +51,6 @@ int main(int argc, char **argv) {
   // Initialize BigInt instances
   BigInteger A(A_str), B(B_str);
 
-  // Define tests using std::array
-  std::array<Test, 10> tests = {
-      Test::TEST_1, Test::TEST_2, Test::TEST_3, Test::TEST_4, Test::TEST_5,
-      Test::TEST_6, Test::TEST_7, Test::TEST_8, Test::TEST_9, Test::TEST_10,
-  };
-
   // Open to output file
   std::ofstream output_file(output_file_name);
   if (!output_file) {
@@ -121,7 +58,7 @@ int main(int argc, char **argv) {
   }
 
   // Write to output file
-  for (const auto &test : tests) {
+  for (const auto &test : GAUNTLET_TESTS) {
     try {
       output_file << arithmetic_gauntlet(A, B, test) << "\n\n";
     } catch (std::logic_error &e) {
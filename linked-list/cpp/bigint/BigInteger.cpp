@@ -6,11 +6,21 @@
  */
 
 #include "BigInteger.h"
+#include "Divide.h"
+#include "Multiply.h"
+#include "SimdLimbs.h"
 
 #include <math.h>
 
-#include <sstream>
+#include <algorithm>
+#include <cstdint>
 #include <stdexcept>
+#include <utility>
+
+// the binary format stores limbs exactly as they are held in memory
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ &&
+                  sizeof(long) == sizeof(int64_t),
+              "BigInteger: write()/read() need 64-bit little-endian longs");
 
 // Global Var --------------------------------------------------------------
 const int power = 9;
@@ -18,86 +28,144 @@ const long base = std::pow(10, power);
 
 // Helpers -----------------------------------------------------------------
 
-// negateList()
-// Changes the sign of each integer in List L. Used by sub().
-void negateList(List &S) {
-  S.moveBack();
-  while (S.position() > 0) {
-    long val = S.movePrev();
-    S.setAfter(-val);
+// toLimbs()
+// Returns the digits L as Limbs for the multiplication and division kernels.
+// Used by multMagnitude(), divmod() and powmod().
+Limbs toLimbs(const LimbBuffer &L) {
+  return Limbs(L.data(), L.data() + L.size());
+}
+
+// fromLimbs()
+// Overwrites the digits L with the Limbs R. Used by multMagnitude(),
+// divmod() and powmod().
+void fromLimbs(LimbBuffer &L, const Limbs &R) {
+  L.assign(R.data(), R.size());
+}
+
+// trimBuffer()
+// Removes leading zero limbs from S.
+void trimBuffer(LimbBuffer &S) {
+  while (!S.empty() && S.back() == 0) {
+    S.pop_back();
   }
 }
 
-// sumList()
-// Overwrites the state of S with A + sgn*B (considered as vectors).
-// Used by both sum() and sub().
-void sumList(List &S, List A, List B, int sgn) {
+// setMagnitude()
+// Overwrites the digits S with the magnitude x. Used by the long
+// constructor and the single-limb fast paths.
+void setMagnitude(LimbBuffer &S, unsigned long x) {
   S.clear();
-  A.moveBack();
-  B.moveBack();
-  while (A.position() > 0 || B.position() > 0) {
-    long value{};
-    if (A.position() > 0) value += A.movePrev();
-    if (B.position() > 0) value += B.movePrev() * sgn;
-    S.insertAfter(value);
+  while (x > 0) {
+    S.push_back(static_cast<long>(x % base));
+    x /= base;
   }
 }
 
-// normalizeList()
-// Performs carries from right to left (least to most significant
-// digits), then returns the sign of the resulting integer. Used
-// by add(), sub() and mult().
-int normalizeList(List &S) {
-  if (S.length() == 0) return 0;
-  int carry{};
-  S.moveBack();
-  while (S.position() > 0) {
-    long data = S.movePrev() + carry;
-    carry = 0;
-    if (data >= base) {
-      carry = data / base;
-      data %= base;
-    } else if (data < 0) {
-      carry = (data - base + 1) / base;
-      data -= carry * base;
-    }
-    S.setAfter(data);
+// compareMagnitude()
+// Returns -1, 1 or 0 according to whether the digits A are less than,
+// greater than or equal to the digits B.
+int compareMagnitude(const LimbBuffer &A, const LimbBuffer &B) {
+  if (A.size() != B.size()) return A.size() < B.size() ? -1 : 1;
+  for (size_t i = A.size(); i-- > 0;) {
+    if (A[i] != B[i]) return A[i] < B[i] ? -1 : 1;
   }
+  return 0;
+}
 
-  if (carry == 0) {
-    // trim leading zeros
-    while (S.length() > 0 && S.peekNext() == 0) {
-      S.eraseAfter();
-    }
-
-    if (S.length() == 0) return 0;
+// addMagnitude()
+// Overwrites the digits S with A + B. S may be A or B.
+void addMagnitude(LimbBuffer &S, const LimbBuffer &A, const LimbBuffer &B) {
+  const LimbBuffer &X = A.size() >= B.size() ? A : B;
+  const LimbBuffer &Y = A.size() >= B.size() ? B : A;
+  // sizes are read first, resizing S may change X or Y
+  size_t nx = X.size(), ny = Y.size();
+  S.resize(nx);
+  long carry = addLimbsN(S.data(), X.data(), Y.data(), ny);
+  for (size_t i = ny; i < nx; i++) {
+    long value = X[i] + carry;
+    carry = value >= base;
+    S[i] = carry ? value - base : value;
   }
+  // only grows (and possibly spills) when the sum needs another limb
+  if (carry) S.push_back(carry);
+}
 
-  if (carry < 0) return -1;
-  if (carry > 0) {
-    S.insertBefore(carry);
+// subMagnitude()
+// Overwrites the digits S with A - B. S may be A or B.
+// pre: A >= B
+void subMagnitude(LimbBuffer &S, const LimbBuffer &A, const LimbBuffer &B) {
+  size_t na = A.size(), nb = B.size();
+  S.resize(na);
+  long borrow = subLimbsN(S.data(), A.data(), B.data(), nb);
+  for (size_t i = nb; i < na; i++) {
+    long value = A[i] - borrow;
+    borrow = value < 0;
+    S[i] = borrow ? value + base : value;
   }
-
-  return 1;
+  trimBuffer(S);
 }
 
-// shiftList()
-// Prepends p zero digits to L, multiplying L by base^p. Used by mult().
-void shiftList(List &S, int p) {
-  S.moveBack();
-  for (int i = 0; i < p; i++) {
-    S.insertAfter(0);
+// addSigned()
+// Overwrites the digits S and sign sgn of a BigInteger with the sum of
+// A_sgn*A and B_sgn*B. S may be A or B. Used by add(), sub(), operator+=()
+// and operator-=().
+void addSigned(LimbBuffer &S, int &sgn, const LimbBuffer &A, int A_sgn,
+               const LimbBuffer &B, int B_sgn) {
+  if (B_sgn == 0) {
+    S = A;
+    sgn = A_sgn;
+    return;
+  }
+  if (A_sgn == 0) {
+    S = B;
+    sgn = B_sgn;
+    return;
+  }
+  // fast path: both fit in one limb, so the sum fits in a long
+  if (A.size() == 1 && B.size() == 1) {
+    long value = A_sgn * A[0] + B_sgn * B[0];
+    sgn = value > 0 ? 1 : (value < 0 ? -1 : 0);
+    setMagnitude(S, value < 0 ? -value : value);
+    return;
+  }
+  if (A_sgn == B_sgn) {
+    addMagnitude(S, A, B);
+    sgn = A_sgn;
+    return;
+  }
+  // opposite signs: subtract the smaller magnitude from the larger
+  int cmp = compareMagnitude(A, B);
+  if (cmp == 0) {
+    S.clear();
+    sgn = 0;
+  } else if (cmp > 0) {
+    subMagnitude(S, A, B);
+    sgn = A_sgn;
+  } else {
+    subMagnitude(S, B, A);
+    sgn = B_sgn;
   }
 }
 
-// scalarMultList()
-// Multiplies L (considered as a vector) by m. Used by mult().
-void scalarMultList(List &S, ListElement m) {
-  S.moveBack();
-  while (S.position() > 0) {
-    long val = S.movePrev();
-    S.setAfter(val * m);
+// multMagnitude()
+// Overwrites the digits S with A * B. S may be A or B.
+void multMagnitude(LimbBuffer &S, const LimbBuffer &A, const LimbBuffer &B) {
+  // fast path: both fit in one limb, so the product fits in a long
+  if (A.size() == 1 && B.size() == 1) {
+    setMagnitude(S, A[0] * B[0]);
+    return;
+  }
+  // short operands skip the conversion to Limbs
+  if (std::min(A.size(), B.size()) <= DEFAULT_CUTOFFS.karatsuba) {
+    LimbBuffer P;
+    P.resize(A.size() + B.size());
+    schoolbookMult(A.data(), A.size(), B.data(), B.size(), P.data());
+    trimBuffer(P);
+    S = std::move(P);
+    return;
   }
+  // Karatsuba, Toom-3 or NTT depending on operand size
+  fromLimbs(S, multLimbs(toLimbs(A), toLimbs(B)));
 }
 
 // Class Constructors & Destructors ----------------------------------------
@@ -109,71 +177,54 @@ BigInteger::BigInteger() : signum(0), digits(){};
 
 // BigInteger()
 // Constructor that creates a new BigInteger from the long value x.
-BigInteger::BigInteger(long x) {
-  if (x == 0) {
-    signum = 0;
-    return;
-  }
-  signum = x > 0 ? 1 : -1;
-  if (x < 0) x = -x;
-  while (x > 0) {
-    digits.insertAfter(x % base);
-    x /= base;
-  }
+BigInteger::BigInteger(long x) : signum(x > 0 ? 1 : (x < 0 ? -1 : 0)) {
+  // negated as unsigned, so LONG_MIN does not overflow
+  setMagnitude(digits, x < 0 ? -static_cast<unsigned long>(x) : x);
 }
 
 // BigInteger()
 // Constructor that creates a new BigInteger from the string s.
 // Pre: s is a non-empty string consisting of (at least one) base 10 digit
 // {0,1,2,3,4,5,6,7,8,9}, and an optional sign {+,-} prefix.
-BigInteger::BigInteger(std::string s) : signum(0) {
+BigInteger::BigInteger(const std::string &s) : signum(0) {
   if (s.length() == 0)
     throw std::invalid_argument("BigInteger: Constructor: empty string");
-  int digit{1}, value{};
-  bool sig{};
-  if (s[0] == '-') {
-    signum = -1;
-    sig = true;
-  } else if (s[0] == '+') {
-    signum = 1;
-    sig = true;
-  }
+  size_t start = (s[0] == '-' || s[0] == '+') ? 1 : 0;
+  if (start == s.length())
+    throw std::invalid_argument("BigInteger: Constructor: non-numeric string");
 
-  bool non_zero{false};
-  int leading_zero = sig ? 1 : 0;
-  while (s[leading_zero] == '0') {
-    leading_zero++;
+  // trim leading zeros
+  while (start < s.length() && s[start] == '0') {
+    start++;
   }
 
-  for (int i = s.length() - 1; i >= leading_zero; i--) {
-    if (s[i] > '9' || s[i] < '0')
-      throw std::invalid_argument(
-          "BigInteger: Constructor: non-numeric string");
-    value += static_cast<int>(s[i] - '0') * digit;
-    digit *= 10;
-    if (digit == base) {
-      if (value > 0) non_zero = true;
-      digits.insertAfter(value);
-      value = 0;
-      digit = 1;
+  // each limb is a run of (up to) 9 digits, read from the right
+  digits.resize((s.length() - start + power - 1) / power);
+  size_t end = s.length();
+  for (size_t k = 0; k < digits.size(); k++) {
+    size_t begin = end - start > power ? end - power : start;
+    for (size_t i = begin; i < end; i++) {
+      if (s[i] > '9' || s[i] < '0')
+        throw std::invalid_argument(
+            "BigInteger: Constructor: non-numeric string");
+      digits[k] = digits[k] * 10 + (s[i] - '0');
     }
+    end = begin;
   }
-  if (value != 0) {
-    digits.insertAfter(value);
-    non_zero = true;
-  }
-  if (!non_zero) return;
-  if (signum != -1) signum = 1;
-  // if (non_zero && signum != -1) {
-  //   signum = 1;
-  // }
+  if (digits.empty()) return;
+  signum = s[0] == '-' ? -1 : 1;
 }
 
 // BigInteger()
 // Constructor that creates a copy of N.
-BigInteger::BigInteger(const BigInteger &N) {
-  digits = N.digits;
-  signum = N.signum;
+BigInteger::BigInteger(const BigInteger &N)
+    : signum(N.signum), digits(N.digits) {}
+
+// BigInteger()
+// Constructor that takes over the digits of N, leaving N zero.
+BigInteger::BigInteger(BigInteger &&N) noexcept
+    : signum(N.signum), digits(std::move(N.digits)) {
+  N.signum = 0;
 }
 
 // Optional Destuctor
@@ -220,135 +271,218 @@ void BigInteger::negate() {
 // Returns a BigInteger representing the sum of this and N.
 // use the helper operators!
 BigInteger BigInteger::add(const BigInteger &N) const {
-  if (signum == 0) return *this;
-  if (N.signum == 0) return N;
-
   BigInteger B;
-
-  // check for subtraction
-  if (signum != N.signum) {
-    if (signum < 0) {
-      B = *this;
-      B.negate();
-      return N.sub(B);
-    } else {
-      B = N;
-      B.negate();
-      return sub(B);
-    }
-  }
-
-  // vector sum
-  sumList(B.digits, digits, N.digits, 1);
-  // normalize
-  normalizeList(B.digits);
-  B.signum = signum;
+  addSigned(B.digits, B.signum, digits, signum, N.digits, N.signum);
   return B;
 }
 
 // sub()
 // Returns a BigInteger representing the difference of this and N.
-// use the helper operators!
 BigInteger BigInteger::sub(const BigInteger &N) const {
-  if (N.signum == 0) return *this;
-
   BigInteger B;
-
-  if (signum == 0) {
-    B = N;
-    B.negate();
-    return B;
-  }
-
-  // case 1: A == B
-  if (*this == N) return B;
-
-  // case 2: addition (-A - B OR A - (-B))
-  if (signum != N.signum || (signum < 0 && N.signum < 0)) {
-    B = N;
-    B.negate();
-    return add(B);
-  }
-  // vector diff
-  sumList(B.digits, digits, N.digits, -1);
-  // A < B
-  bool neg = *this < N;
-  // negate digit list if needed
-  if (neg) negateList(B.digits);
-  // normalize and store sign
-  B.signum = normalizeList(B.digits);
-  if (neg) B.negate();
+  addSigned(B.digits, B.signum, digits, signum, N.digits, -N.signum);
   return B;
 }
 
 // mult()
 // Returns a BigInteger representing the product of this and N.
-// use the helper operators!
 BigInteger BigInteger::mult(const BigInteger &N) const {
   BigInteger B;
   // mult by 0
   if (N.signum == 0 || signum == 0) return B;
   // check to see if one number is negative using XOR
   B.signum = ((N.signum < 0) ^ (signum < 0)) ? -1 : 1;
-  // copy N.digits
-  List ND = N.digits;
-  // shift amount
-  int shift{};
-  ND.moveBack();
-  // for each digit in N
-  while (ND.position() > 0) {
-    List D = digits;
-    // shift D
-    shiftList(D, shift++);
-    // multiply A.digits by the current digit
-    long current = ND.movePrev();
-    scalarMultList(D, current);
-    // add the multiplied number
-    sumList(B.digits, B.digits, D, 1);
-    // normalize
-    normalizeList(B.digits);
-  }
+  multMagnitude(B.digits, digits, N.digits);
   return B;
 }
 
+// divmod()
+// Overwrites Q and R with the quotient and remainder of this divided by N.
+// The quotient is truncated toward zero and the remainder takes the sign
+// of this, as with the built-in integer types.
+// pre: N is non-zero
+void BigInteger::divmod(const BigInteger &N, BigInteger &Q,
+                        BigInteger &R) const {
+  if (N.signum == 0)
+    throw std::domain_error("BigInteger: divmod(): division by zero");
+  // Q or R may alias this or N
+  int sign = signum, N_sign = N.signum;
+  Limbs quotient, remainder;
+  // Knuth's algorithm D or a Newton reciprocal depending on operand size
+  divmodLimbs(toLimbs(digits), toLimbs(N.digits), quotient, remainder);
+  fromLimbs(Q.digits, quotient);
+  Q.signum = quotient.empty() ? 0 : sign * N_sign;
+  fromLimbs(R.digits, remainder);
+  R.signum = remainder.empty() ? 0 : sign;
+}
+
 // Other Functions ---------------------------------------------------------
 
+// chars_length()
+// Returns the number of characters in the string representation of this
+// BigInteger, including the sign.
+size_t BigInteger::chars_length() const {
+  if (signum == 0) return 1;
+  size_t n = (signum < 0 ? 1 : 0) + power * (digits.size() - 1);
+  for (long top = digits.back(); top > 0; top /= 10) {
+    n++;
+  }
+  return n;
+}
+
+// to_chars()
+// Writes the string representation of this BigInteger (as to_string()) into
+// the buffer [first, last), without a terminating null character. Returns a
+// pointer one past the last character written, or nullptr if the buffer is
+// shorter than chars_length().
+char *BigInteger::to_chars(char *first, char *last) const {
+  size_t n = chars_length();
+  if (static_cast<size_t>(last - first) < n) return nullptr;
+  if (signum == 0) {
+    *first = '0';
+    return first + 1;
+  }
+  // fill right to left, least significant limb first; every limb but the
+  // most significant is zero padded to 9 digits
+  char *cursor = first + n;
+  for (size_t i = 0; i < digits.size(); i++) {
+    long limb = digits[i];
+    bool most_significant = i + 1 == digits.size();
+    for (int d = 0; d < power && (!most_significant || limb > 0); d++) {
+      *--cursor = static_cast<char>('0' + limb % 10);
+      limb /= 10;
+    }
+  }
+  if (signum < 0) *--cursor = '-';
+  return first + n;
+}
+
 // to_string()
 // Returns a string representation of this BigInteger consisting of its
 // base 10 digits. If this BigInteger is negative, the returned string
 // will begin with a negative sign '-'. If this BigInteger is zero, the
 // returned string will consist of the character '0' only.
-std::string BigInteger::to_string() {
-  if (digits.length() == 0) return "0";
-  std::ostringstream oss;
-  oss << (signum == -1 ? "-" : "");
-  digits.moveFront();
-  bool first{};
-  while (digits.position() < digits.length()) {
-    std::string str = std::to_string(digits.moveNext());
-    if (!first && str == "0") continue;
-    if (first) {
-      for (int i = str.length(); i < power; i++) oss << '0';
-    }
-    oss << str;
-    first = true;
+std::string BigInteger::to_string() const {
+  std::string str(chars_length(), '0');
+  to_chars(&str[0], &str[0] + str.length());
+  return str;
+}
+
+// write()
+// Writes this BigInteger to stream in binary: the sign and the limb count as
+// 64-bit integers, then the limbs as 64-bit integers, least significant first,
+// all little-endian.
+void BigInteger::write(std::ostream &stream) const {
+  int64_t header[2] = {signum, static_cast<int64_t>(digits.size())};
+  stream.write(reinterpret_cast<const char *>(header), sizeof(header));
+  stream.write(reinterpret_cast<const char *>(digits.data()),
+               digits.size() * sizeof(long));
+}
+
+// read()
+// Overwrites this BigInteger with one written by write(). Throws
+// std::invalid_argument, leaving this BigInteger unchanged, if the stream ends
+// early or does not hold a normalized BigInteger.
+void BigInteger::read(std::istream &stream) {
+  int64_t header[2];
+  if (!stream.read(reinterpret_cast<char *>(header), sizeof(header)))
+    throw std::invalid_argument("BigInteger: read(): missing header");
+  int64_t sign = header[0], count = header[1];
+  if (sign < -1 || sign > 1 || count < 0 || (sign == 0) != (count == 0))
+    throw std::invalid_argument("BigInteger: read(): invalid header");
+
+  // read in chunks, so a corrupt count fails at the end of the stream rather
+  // than on one huge allocation
+  LimbBuffer limbs;
+  const size_t chunk = size_t(1) << 20;
+  while (limbs.size() < static_cast<size_t>(count)) {
+    size_t start = limbs.size();
+    size_t n = std::min(chunk, static_cast<size_t>(count) - start);
+    limbs.resize(start + n);
+    if (!stream.read(reinterpret_cast<char *>(limbs.data() + start),
+                     n * sizeof(long)))
+      throw std::invalid_argument("BigInteger: read(): missing limbs");
   }
-  if (oss.str().empty()) return "0";
-  return oss.str();
+  for (size_t i = 0; i < limbs.size(); i++) {
+    if (limbs[i] < 0 || limbs[i] >= base)
+      throw std::invalid_argument("BigInteger: read(): limb out of range");
+  }
+  if (!limbs.empty() && limbs.back() == 0)
+    throw std::invalid_argument("BigInteger: read(): leading zero limb");
+  signum = static_cast<int>(sign);
+  digits = std::move(limbs);
+}
+
+// pow()
+// Returns B raised to the power e.
+BigInteger pow(const BigInteger &B, unsigned e) {
+  BigInteger result(1);
+  BigInteger square = B;
+  // binary exponentiation, least significant bit first
+  while (e > 0) {
+    if (e & 1) result *= square;
+    e >>= 1;
+    if (e > 0) square *= square;
+  }
+  return result;
+}
+
+// powmod()
+// Returns B raised to the power E modulo M, in the range [0, M).
+// pre: E >= 0, M > 0
+BigInteger powmod(const BigInteger &B, const BigInteger &E,
+                  const BigInteger &M) {
+  if (E.signum < 0)
+    throw std::domain_error("BigInteger: powmod(): negative exponent");
+  if (M.signum <= 0)
+    throw std::domain_error("BigInteger: powmod(): non-positive modulus");
+  BigInteger result;
+  Limbs exponent = toLimbs(E.digits);
+  fromLimbs(result.digits,
+            powmodLimbs(toLimbs(B.digits), exponent, toLimbs(M.digits)));
+  result.signum = result.digits.empty() ? 0 : 1;
+  // (-B)^E = -(B^E) for odd E
+  if (B.signum < 0 && result.signum != 0 && !exponent.empty() &&
+      (exponent[0] & 1)) {
+    result = M - result;
+  }
+  return result;
 }
 
 // Overriden Operators -----------------------------------------------------
 
+// operator=()
+// Overwrites the state of this BigInteger with the state of N.
+BigInteger &BigInteger::operator=(const BigInteger &N) {
+  if (this != &N) {
+    digits = N.digits;
+    signum = N.signum;
+  }
+  return *this;
+}
+
+// operator=()
+// Takes over the digits of N, leaving N zero.
+BigInteger &BigInteger::operator=(BigInteger &&N) noexcept {
+  if (this != &N) {
+    digits = std::move(N.digits);
+    signum = N.signum;
+    N.digits.clear();
+    N.signum = 0;
+  }
+  return *this;
+}
+
 // operator<<()
 // Inserts string representation of N into stream.
-std::ostream &operator<<(std::ostream &stream, BigInteger N) {
+std::ostream &operator<<(std::ostream &stream, const BigInteger &N) {
   return stream << N.to_string();
 }
 
 // operator==()
 // Returns true if and only if A equals B.
 bool operator==(const BigInteger &A, const BigInteger &B) {
-  return ((A.signum == B.signum) && (A.digits.equals(B.digits)));
+  return ((A.signum == B.signum) && (A.digits == B.digits));
 }
 
 // operator<()
@@ -364,33 +498,10 @@ bool operator<(const BigInteger &A, const BigInteger &B) {
 
   // we now know A.signum == B.signum
 
-  // compare lengths
-  // if A is positive and has less digits or if A is negative and has more
-  // digits
-  if ((A.signum > 0 && A.digits.length() < B.digits.length()) ||
-      (A.signum < 0 && A.digits.length() > B.digits.length()))
-    return true;
-  if ((A.signum > 0 && A.digits.length() > B.digits.length()) ||
-      (A.signum < 0 && A.digits.length() < B.digits.length()))
-    return false;
-
-  // compare msd to lsd
-  List AD = A.digits;
-  List BD = B.digits;
-  AD.moveFront();
-  BD.moveFront();
-
-  int len = AD.length();
-  // for each number in the list
-  for (int i = 0; i < len; i++) {
-    long A_val = AD.moveNext();
-    long B_val = BD.moveNext();
-    // if A digit < B digit and its positive
-    if (A_val < B_val) return A.signum > 0;
-    // if A digit > B digit and its negative
-    if (A_val > B_val) return A.signum < 0;
-  }
-  return false;
+  // compare lengths, then msd to lsd
+  int cmp = compareMagnitude(A.digits, B.digits);
+  // smaller magnitude and positive, or larger magnitude and negative
+  return A.signum > 0 ? cmp < 0 : cmp > 0;
 }
 
 // operator<=()
@@ -410,31 +521,10 @@ bool operator>(const BigInteger &A, const BigInteger &B) {
 
   // we now know A.signum == B.signum
 
-  // compare lengths
-  if ((A.signum > 0 && A.digits.length() < B.digits.length()) ||
-      (A.signum < 0 && A.digits.length() > B.digits.length()))
-    return false;
-  if ((A.signum > 0 && A.digits.length() > B.digits.length()) ||
-      (A.signum < 0 && A.digits.length() < B.digits.length()))
-    return true;
-
-  // compare msd to lsd
-  List AD = A.digits;
-  List BD = B.digits;
-  AD.moveFront();
-  BD.moveFront();
-
-  int len = AD.length();
-  // for each number in the list
-  for (int i = 0; i < len; i++) {
-    long A_val = AD.moveNext();
-    long B_val = BD.moveNext();
-    // if A digit > B digit and its positive
-    if (A_val > B_val) return A.signum > 0;
-    // if A digit < B digit and its negative
-    if (A_val < B_val) return A.signum < 0;
-  }
-  return false;
+  // compare lengths, then msd to lsd
+  int cmp = compareMagnitude(A.digits, B.digits);
+  // larger magnitude and positive, or smaller magnitude and negative
+  return A.signum > 0 ? cmp > 0 : cmp < 0;
 }
 
 // operator>=()
@@ -448,9 +538,9 @@ BigInteger operator+(const BigInteger &A, const BigInteger &B) {
 }
 
 // operator+=()
-// Overwrites A with the sum A+B.
-BigInteger operator+=(BigInteger &A, const BigInteger &B) {
-  A = A.add(B);
+// Overwrites A with the sum A+B, and returns A.
+BigInteger &operator+=(BigInteger &A, const BigInteger &B) {
+  addSigned(A.digits, A.signum, A.digits, A.signum, B.digits, B.signum);
   return A;
 }
 
@@ -461,9 +551,9 @@ BigInteger operator-(const BigInteger &A, const BigInteger &B) {
 }
 
 // operator-=()
-// Overwrites A with the difference A-B.
-BigInteger operator-=(BigInteger &A, const BigInteger &B) {
-  A = A.sub(B);
+// Overwrites A with the difference A-B, and returns A.
+BigInteger &operator-=(BigInteger &A, const BigInteger &B) {
+  addSigned(A.digits, A.signum, A.digits, A.signum, B.digits, -B.signum);
   return A;
 }
 
@@ -474,8 +564,49 @@ BigInteger operator*(const BigInteger &A, const BigInteger &B) {
 }
 
 // operator*=()
-// Overwrites A with the product A*B.
-BigInteger operator*=(BigInteger &A, const BigInteger &B) {
-  A = A * B;
+// Overwrites A with the product A*B, and returns A.
+BigInteger &operator*=(BigInteger &A, const BigInteger &B) {
+  if (A.signum == 0 || B.signum == 0) {
+    A.makeZero();
+    return A;
+  }
+  A.signum = ((A.signum < 0) ^ (B.signum < 0)) ? -1 : 1;
+  multMagnitude(A.digits, A.digits, B.digits);
   return A;
-}
\ No newline at end of file
+}
+
+// operator/()
+// Returns the quotient A/B, truncated toward zero.
+// pre: B is non-zero
+BigInteger operator/(const BigInteger &A, const BigInteger &B) {
+  BigInteger Q, R;
+  A.divmod(B, Q, R);
+  return Q;
+}
+
+// operator/=()
+// Overwrites A with the quotient A/B, and returns A.
+// pre: B is non-zero
+BigInteger &operator/=(BigInteger &A, const BigInteger &B) {
+  BigInteger R;
+  A.divmod(B, A, R);
+  return A;
+}
+
+// operator%()
+// Returns the remainder A%B, which has the sign of A.
+// pre: B is non-zero
+BigInteger operator%(const BigInteger &A, const BigInteger &B) {
+  BigInteger Q, R;
+  A.divmod(B, Q, R);
+  return R;
+}
+
+// operator%=()
+// Overwrites A with the remainder A%B, and returns A.
+// pre: B is non-zero
+BigInteger &operator%=(BigInteger &A, const BigInteger &B) {
+  BigInteger Q;
+  A.divmod(B, Q, A);
+  return A;
+}
@@ -5,7 +5,7 @@
 #include <iostream>
 #include <string>
 
-#include "List.h"
+#include "LimbBuffer.h"
 
 #ifndef BIG_INTEGER_H_INCLUDE_
 #define BIG_INTEGER_H_INCLUDE_
@@ -14,8 +14,11 @@
 class BigInteger {
  private:
   // BigInteger Fields
-  int signum;   // +1 (positive), -1 (negative), 0 (zero)
-  List digits;  // List of digits in this BigInteger
+  int signum;         // +1 (positive), -1 (negative), 0 (zero)
+  LimbBuffer digits;  // base 10^9 limbs, least significant first
+
+  // copies limbs out of a mapped file (BigIntegerView.h)
+  friend class BigIntegerView;
 
  public:
   // Class Constructors & Destructors ----------------------------------------
@@ -33,12 +36,16 @@ class BigInteger {
   // Constructor that creates a new BigInteger from the string s.
   // Pre: s is a non-empty string consisting of (at least one) base 10 digit
   // {0,1,2,3,4,5,6,7,8,9}, and an optional sign {+,-} prefix.
-  BigInteger(std::string s);
+  BigInteger(const std::string &s);
 
   // BigInteger()
   // Constructor that creates a copy of N.
   BigInteger(const BigInteger &N);
 
+  // BigInteger()
+  // Constructor that takes over the digits of N, leaving N zero.
+  BigInteger(BigInteger &&N) noexcept;
+
   // Optional Destuctor
   // ~BigInteger()
   // ~BigInteger();
@@ -80,6 +87,13 @@ class BigInteger {
   // Returns a BigInteger representing the product of this and N.
   BigInteger mult(const BigInteger &N) const;
 
+  // divmod()
+  // Overwrites Q and R with the quotient and remainder of this divided by N.
+  // The quotient is truncated toward zero and the remainder takes the sign
+  // of this, as with the built-in integer types.
+  // pre: N is non-zero
+  void divmod(const BigInteger &N, BigInteger &Q, BigInteger &R) const;
+
   // Other Functions ---------------------------------------------------------
 
   // to_string()
@@ -87,13 +101,55 @@ class BigInteger {
   // base 10 digits. If this BigInteger is negative, the returned string
   // will begin with a negative sign '-'. If this BigInteger is zero, the
   // returned string will consist of the character '0' only.
-  std::string to_string();
+  std::string to_string() const;
+
+  // chars_length()
+  // Returns the number of characters in the string representation of this
+  // BigInteger, including the sign.
+  size_t chars_length() const;
+
+  // to_chars()
+  // Writes the string representation of this BigInteger (as to_string())
+  // into the buffer [first, last), without a terminating null character.
+  // Returns a pointer one past the last character written, or nullptr if the
+  // buffer is shorter than chars_length().
+  char *to_chars(char *first, char *last) const;
+
+  // write()
+  // Writes this BigInteger to stream in binary: the sign and the limb count
+  // as 64-bit integers, then the base 10^9 limbs as 64-bit integers, least
+  // significant first, all little-endian.
+  void write(std::ostream &stream) const;
+
+  // read()
+  // Overwrites this BigInteger with one written by write(). Throws
+  // std::invalid_argument, leaving this BigInteger unchanged, if the stream
+  // ends early or does not hold a normalized BigInteger.
+  void read(std::istream &stream);
+
+  // pow()
+  // Returns B raised to the power e.
+  friend BigInteger pow(const BigInteger &B, unsigned e);
+
+  // powmod()
+  // Returns B raised to the power E modulo M, in the range [0, M).
+  // pre: E >= 0, M > 0
+  friend BigInteger powmod(const BigInteger &B, const BigInteger &E,
+                           const BigInteger &M);
 
   // Overriden Operators -----------------------------------------------------
 
+  // operator=()
+  // Overwrites the state of this BigInteger with the state of N.
+  BigInteger &operator=(const BigInteger &N);
+
+  // operator=()
+  // Takes over the digits of N, leaving N zero.
+  BigInteger &operator=(BigInteger &&N) noexcept;
+
   // operator<<()
   // Inserts string representation of N into stream.
-  friend std::ostream &operator<<(std::ostream &stream, BigInteger N);
+  friend std::ostream &operator<<(std::ostream &stream, const BigInteger &N);
 
   // operator==()
   // Returns true if and only if A equals B.
@@ -120,24 +176,44 @@ class BigInteger {
   friend BigInteger operator+(const BigInteger &A, const BigInteger &B);
 
   // operator+=()
-  // Overwrites A with the sum A+B.
-  friend BigInteger operator+=(BigInteger &A, const BigInteger &B);
+  // Overwrites A with the sum A+B, and returns A.
+  friend BigInteger &operator+=(BigInteger &A, const BigInteger &B);
 
   // operator-()
   // Returns the difference A-B.
   friend BigInteger operator-(const BigInteger &A, const BigInteger &B);
 
   // operator-=()
-  // Overwrites A with the difference A-B.
-  friend BigInteger operator-=(BigInteger &A, const BigInteger &B);
+  // Overwrites A with the difference A-B, and returns A.
+  friend BigInteger &operator-=(BigInteger &A, const BigInteger &B);
 
   // operator*()
   // Returns the product A*B.
   friend BigInteger operator*(const BigInteger &A, const BigInteger &B);
 
   // operator*=()
-  // Overwrites A with the product A*B.
-  friend BigInteger operator*=(BigInteger &A, const BigInteger &B);
+  // Overwrites A with the product A*B, and returns A.
+  friend BigInteger &operator*=(BigInteger &A, const BigInteger &B);
+
+  // operator/()
+  // Returns the quotient A/B, truncated toward zero.
+  // pre: B is non-zero
+  friend BigInteger operator/(const BigInteger &A, const BigInteger &B);
+
+  // operator/=()
+  // Overwrites A with the quotient A/B, and returns A.
+  // pre: B is non-zero
+  friend BigInteger &operator/=(BigInteger &A, const BigInteger &B);
+
+  // operator%()
+  // Returns the remainder A%B, which has the sign of A.
+  // pre: B is non-zero
+  friend BigInteger operator%(const BigInteger &A, const BigInteger &B);
+
+  // operator%=()
+  // Overwrites A with the remainder A%B, and returns A.
+  // pre: B is non-zero
+  friend BigInteger &operator%=(BigInteger &A, const BigInteger &B);
 };
 
 #endif
\ No newline at end of file
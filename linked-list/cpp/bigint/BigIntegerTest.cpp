@@ -5,10 +5,31 @@
  * @status: working / tested
  */
 
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <random>
+#include <sstream>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 #include "BigInteger.h"
+#include "BigIntegerView.h"
+#include "Divide.h"
+#include "Multiply.h"
+#include "SimdLimbs.h"
+
+// std::vector<BigInteger> only moves its elements when it grows if moving
+// cannot throw; otherwise it copies every one.
+static_assert(std::is_nothrow_move_constructible<BigInteger>::value &&
+                  std::is_nothrow_move_assignable<BigInteger>::value,
+              "BigInteger moves should be noexcept");
+static_assert(std::is_nothrow_move_constructible<LimbBuffer>::value &&
+                  std::is_nothrow_move_assignable<LimbBuffer>::value,
+              "LimbBuffer moves should be noexcept");
 
 /**
  * @brief Custom assertion function that throws an exception on failure.
@@ -188,6 +209,547 @@ void test_multiplication() {
   expect((F * G).sign() == -1, "-(F) * G should return negative");
 }
 
+/**
+ * @brief Builds a random operand with exactly n limbs.
+ */
+Limbs random_limbs(size_t n, std::mt19937_64 &rng) {
+  std::uniform_int_distribution<long> limb(0, LIMB_BASE - 1);
+  Limbs L(n);
+  for (size_t i = 0; i < n; i++) L[i] = limb(rng);
+  L[n - 1] = 1 + limb(rng) % (LIMB_BASE - 1);
+  return L;
+}
+
+/**
+ * @brief Cross-checks the vector limb and search kernels at every supported
+ *        SimdLevel against the scalar ones, including long carry and borrow
+ *        chains, results written over an operand and repeated search keys.
+ */
+void test_simd_kernels() {
+  std::mt19937_64 rng(202);
+  SimdLevel detected = detectSimdLevel();
+  for (int trial = 0; trial < 400; trial++) {
+    size_t n = rng() % 70;
+    Limbs A = random_limbs(n + 1, rng), B = random_limbs(n + 1, rng);
+    A.pop_back();
+    B.pop_back();
+    if (trial % 4 == 1) {
+      // all 9s plus 0 or 1 carries through every limb
+      for (size_t i = 0; i < n; i++) {
+        A[i] = LIMB_BASE - 1;
+        B[i] = i == 0;
+      }
+    } else if (trial % 4 == 2) {
+      // equal limbs propagate a borrow through every limb
+      B = A;
+      if (n > 0) B[0] = A[0] + 1 == LIMB_BASE ? 0 : A[0] + 1;
+    }
+    long m = trial % 3 == 0 ? LIMB_BASE - 1 : static_cast<long>(rng() % 1000);
+    // few distinct values, so keys repeat or are missing
+    std::vector<long> K(n);
+    for (long &k : K) k = static_cast<long>(rng() % 6) - 1;
+    long key = static_cast<long>(rng() % 6);
+
+    Limbs expected[3] = {Limbs(n), Limbs(n), Limbs(n)};
+    long expected_out[3];
+    setSimdLevel(SimdLevel::SCALAR);
+    expected_out[0] = addLimbsN(expected[0].data(), A.data(), B.data(), n);
+    expected_out[1] = subLimbsN(expected[1].data(), A.data(), B.data(), n);
+    expected_out[2] = scaleLimbsN(expected[2].data(), A.data(), n, m);
+    size_t first = findFirstN(K.data(), n, key, SimdLevel::SCALAR);
+    size_t last = findLastN(K.data(), n, key, SimdLevel::SCALAR);
+    for (int level = 1; level <= static_cast<int>(detected); level++) {
+      setSimdLevel(static_cast<SimdLevel>(level));
+      Limbs R = A;
+      expect(addLimbsN(R.data(), R.data(), B.data(), n) == expected_out[0] &&
+                 R == expected[0],
+             "vector add should match scalar");
+      R = A;
+      expect(subLimbsN(R.data(), R.data(), B.data(), n) == expected_out[1] &&
+                 R == expected[1],
+             "vector sub should match scalar");
+      R = A;
+      expect(scaleLimbsN(R.data(), R.data(), n, m) == expected_out[2] &&
+                 R == expected[2],
+             "vector scale should match scalar");
+      SimdLevel search = static_cast<SimdLevel>(level);
+      expect(findFirstN(K.data(), n, key, search) == first &&
+                 findLastN(K.data(), n, key, search) == last,
+             "vector search should match scalar");
+    }
+  }
+  setSimdLevel(detected);
+}
+
+/**
+ * @brief Cross-checks Karatsuba, Toom-3, NTT and unbalanced splitting against
+ *        schoolbook multiplication on random operands.
+ */
+void test_multiplication_kernels() {
+  std::mt19937_64 rng(101);
+  // tiny cutoffs so that every algorithm recurses several levels
+  const size_t never = static_cast<size_t>(-1);
+  const MultCutoffs karatsuba_only = {4, never, never};
+  const MultCutoffs toom3 = {4, 12, never};
+  const MultCutoffs ntt = {4, 12, 40};
+  const size_t sizes[][2] = {{1, 1},   {5, 5},    {17, 16}, {64, 33},
+                             {100, 7}, {150, 149}, {301, 250}};
+  for (const auto &size : sizes) {
+    Limbs A = random_limbs(size[0], rng);
+    Limbs B = random_limbs(size[1], rng);
+    Limbs expected = schoolbookMult(A, B);
+    expect(multLimbs(A, B, karatsuba_only) == expected,
+           "Karatsuba product should match schoolbook");
+    expect(multLimbs(A, B, toom3) == expected,
+           "Toom-3 product should match schoolbook");
+    expect(multLimbs(A, B, ntt) == expected,
+           "Toom-3/NTT product should match schoolbook");
+    expect(nttMult(A, B) == expected, "NTT product should match schoolbook");
+    expect(multLimbs(B, A) == expected,
+           "Default product should match schoolbook");
+  }
+
+  // limbs of all 9s maximize every carry
+  Limbs nines(200, LIMB_BASE - 1);
+  expect(multLimbs(nines, nines, toom3) == schoolbookMult(nines, nines),
+         "Toom-3 product of all 9s should match schoolbook");
+  expect(nttMult(nines, nines) == schoolbookMult(nines, nines),
+         "NTT product of all 9s should match schoolbook");
+
+  // long enough for every NTT convolution term to exceed two of the primes
+  for (int i = 0; i < 3; i++) {
+    Limbs A = random_limbs(3000 + i * 517, rng);
+    Limbs B = random_limbs(2000 + i * 333, rng);
+    expect(nttMult(A, B) == schoolbookMult(A, B),
+           "Long NTT product should match schoolbook");
+  }
+
+  // (10^k - 1)^2 = 10^2k - 2*10^k + 1
+  std::string k_nines(3000, '9');
+  BigInteger N(k_nines);
+  std::string expected = std::string(2999, '9') + "8" +
+                         std::string(2999, '0') + "1";
+  expect((N * N).to_string() == expected, "(10^k - 1)^2 should be exact");
+  N.negate();
+  expect((N * N).to_string() == expected, "(-(10^k - 1))^2 should be exact");
+  expect((N * BigInteger(N.sign())).sign() == 1, "-N * -1 should be positive");
+}
+
+/**
+ * @brief Cross-checks the threaded Karatsuba, Toom-3, unbalanced and NTT
+ *        products against the single-threaded ones.
+ */
+void test_parallel_mult() {
+  std::mt19937_64 rng(303);
+  const size_t never = static_cast<size_t>(-1);
+  const MultCutoffs karatsuba_only = {DEFAULT_CUTOFFS.karatsuba, never, never};
+  const MultCutoffs toom3 = {DEFAULT_CUTOFFS.karatsuba, DEFAULT_CUTOFFS.toom3,
+                             never};
+  // above PARALLEL_CUTOFF, unbalanced, and long enough for threaded NTT stages
+  const size_t sizes[][2] = {{600, 600}, {2000, 300}, {20000, 19000}};
+  for (const auto &size : sizes) {
+    Limbs A = random_limbs(size[0], rng);
+    Limbs B = random_limbs(size[1], rng);
+    Limbs expected[3] = {multLimbs(A, B, karatsuba_only),
+                         multLimbs(A, B, toom3), multLimbs(A, B)};
+    setMultThreads(4);
+    expect(multThreads() == 4, "multThreads() should be 4");
+    expect(multLimbs(A, B, karatsuba_only) == expected[0],
+           "Threaded Karatsuba product should match 1 thread");
+    expect(multLimbs(A, B, toom3) == expected[1],
+           "Threaded Toom-3 product should match 1 thread");
+    expect(multLimbs(A, B) == expected[2],
+           "Threaded default product should match 1 thread");
+    setMultThreads(1);
+  }
+  expect(multThreads() == 1, "multThreads() should be back to 1");
+  try {
+    setMultThreads(0);
+    expect(false, "setMultThreads(0) should throw");
+  } catch (const std::invalid_argument &) {
+  }
+}
+
+/**
+ * @brief Cross-checks Knuth and Newton division against each other and
+ *        against the identity A = Q*B + R with 0 <= R < B.
+ */
+void test_division_kernels() {
+  std::mt19937_64 rng(202);
+  const size_t sizes[][2] = {{1, 1},  {3, 1},   {9, 2},    {40, 20},
+                             {80, 79}, {200, 50}, {300, 150}, {500, 120}};
+  for (const auto &size : sizes) {
+    Limbs A = random_limbs(size[0], rng);
+    Limbs B = random_limbs(size[1], rng);
+    Limbs Q1, R1, Q2, R2;
+    knuthDivmod(A, B, Q1, R1);
+    newtonDivmod(A, B, Q2, R2);
+    expect(Q1 == Q2 && R1 == R2, "Newton divmod should match Knuth divmod");
+    expect(compareLimbs(R1, B) < 0, "Remainder should be less than divisor");
+    expect(addLimbs(multLimbs(Q1, B), R1) == A, "Q*B + R should equal A");
+  }
+
+  // divisors with a small top limb need the most qhat corrections
+  Limbs A(120, LIMB_BASE - 1), B(60, 0);
+  B[59] = 1;
+  B[0] = 1;
+  Limbs Q1, R1, Q2, R2;
+  knuthDivmod(A, B, Q1, R1);
+  newtonDivmod(A, B, Q2, R2);
+  expect(Q1 == Q2 && R1 == R2, "Newton should match Knuth on 10^k + 1");
+  expect(addLimbs(multLimbs(Q1, B), R1) == A, "Q*B + R should equal A");
+
+  // floor(LIMB_BASE^m / B) must be exact: B*X <= LIMB_BASE^m < B*(X+1)
+  Limbs C = random_limbs(150, rng);
+  Limbs X = reciprocalLimbs(C, 400);
+  Limbs P(401);
+  P[400] = 1;
+  expect(compareLimbs(multLimbs(C, X), P) <= 0, "Reciprocal too large");
+  expect(compareLimbs(multLimbs(C, addLimbs(X, Limbs{1})), P) > 0,
+         "Reciprocal too small");
+
+  // Barrett reduction against algorithm D
+  const size_t never = static_cast<size_t>(-1);
+  Limbs M = random_limbs(30, rng);
+  Limbs E = random_limbs(3, rng);
+  expect(powmodLimbs(C, E, M, 0) == powmodLimbs(C, E, M, never),
+         "Barrett powmod should match Knuth powmod");
+}
+
+/**
+ * @brief Tests divmod(), operator/, operator%, pow() and powmod().
+ */
+void test_division() {
+  // truncated toward zero, remainder takes the sign of the dividend
+  const long values[][2] = {{7, 2}, {-7, 2}, {7, -2}, {-7, -2}, {6, 3},
+                            {0, 5}, {3, 8},  {-3, 8}, {1000000007, 1000}};
+  for (const auto &value : values) {
+    BigInteger A(value[0]), B(value[1]);
+    expect(A / B == BigInteger(value[0] / value[1]), "A / B should truncate");
+    expect(A % B == BigInteger(value[0] % value[1]),
+           "A % B should take the sign of A");
+  }
+
+  BigInteger A("-123456789012345678901234567890123456789");
+  BigInteger B("9876543210987654321");
+  BigInteger Q, R;
+  A.divmod(B, Q, R);
+  expect(Q.to_string() == "-12499999886093750001", "Quotient should match");
+  expect(R.to_string() == "-5420524680542052468", "Remainder should match");
+  expect(Q * B + R == A, "Q*B + R should equal A");
+  A.divmod(B, A, B);
+  expect(A == Q && B == R, "divmod() should allow Q and R to alias");
+
+  A /= BigInteger(-1);
+  expect(A.to_string() == "12499999886093750001", "A /= -1 should negate");
+  A %= BigInteger(1000);
+  expect(A == BigInteger(1), "A %= 1000 should be 1");
+  A %= BigInteger(1);
+  expect(A.sign() == 0, "A %= 1 should be zero");
+
+  try {
+    A / BigInteger(0);
+    expect(false, "Division by zero should throw");
+  } catch (std::domain_error &) {
+  }
+
+  // pow() against repeated multiplication
+  BigInteger C(-3), D(1);
+  for (int i = 0; i < 101; i++) D *= C;
+  expect(pow(C, 101) == D, "pow() should match repeated multiplication");
+  expect(pow(C, 0) == BigInteger(1), "pow(C, 0) should be 1");
+
+  // Fermat: a^(p-1) = 1 mod p for the Mersenne prime 2^127 - 1
+  BigInteger p = pow(BigInteger(2), 127) - BigInteger(1);
+  expect(p.to_string() == "170141183460469231731687303715884105727",
+         "2^127 - 1 should be exact");
+  expect(powmod(BigInteger("123456789123456789"), p - BigInteger(1), p) ==
+             BigInteger(1),
+         "a^(p-1) mod p should be 1");
+  // negative bases reduce into [0, M)
+  BigInteger M(10000019);
+  expect(powmod(BigInteger(-2), BigInteger(21), M) == M - BigInteger(2097152),
+         "(-2)^21 mod M should be M - 2^21");
+  expect(powmod(BigInteger(-2), BigInteger(0), M) == BigInteger(1),
+         "(-2)^0 mod M should be 1");
+  expect(powmod(pow(BigInteger(7), 300), BigInteger(3), M) ==
+             pow(BigInteger(7), 900) % M,
+         "powmod() should match pow() % M");
+}
+
+/**
+ * @brief Tests the string constructor, to_string(), to_chars() and
+ *        operator<<().
+ */
+void test_string_conversion() {
+  // limb boundaries, leading zeros and signs
+  const std::string cases[][2] = {
+      {"0", "0"},
+      {"-0", "0"},
+      {"+000", "0"},
+      {"7", "7"},
+      {"-000000000000123", "-123"},
+      {"999999999", "999999999"},
+      {"1000000000", "1000000000"},
+      {"+1000000000000000000", "1000000000000000000"},
+      {"-123456789000000001", "-123456789000000001"}};
+  for (const auto &c : cases) {
+    BigInteger A(c[0]);
+    expect(A.to_string() == c[1], "to_string() of " + c[0]);
+    expect(A.chars_length() == c[1].length(), "chars_length() of " + c[0]);
+  }
+  expect(BigInteger("-0").sign() == 0, "String '-0' should have sign 0");
+
+  // round trip of a long random digit string
+  std::mt19937_64 rng(303);
+  std::string digits = "-" + std::to_string(1 + rng() % 9);
+  for (int i = 0; i < 10000; i++) digits += static_cast<char>('0' + rng() % 10);
+  BigInteger B(digits);
+  expect(B.to_string() == digits, "Long string should round trip");
+
+  // to_chars() writes into the caller's buffer without a null
+  char buffer[32];
+  BigInteger C("-1234567890123");
+  char *end = C.to_chars(buffer, buffer + sizeof(buffer));
+  expect(end == buffer + 14, "to_chars() should return one past the end");
+  expect(std::string(buffer, end) == "-1234567890123", "to_chars() digits");
+  expect(C.to_chars(buffer, buffer + 13) == nullptr,
+         "to_chars() should fail on a short buffer");
+
+  std::ostringstream stream;
+  const BigInteger &D = C;
+  stream << D << ' ' << BigInteger();
+  expect(stream.str() == "-1234567890123 0", "operator<<() should print");
+
+  for (const std::string s : {"", "-", "+", "12a4", " 1"}) {
+    try {
+      BigInteger E(s);
+      expect(false, "Constructor should reject '" + s + "'");
+    } catch (std::invalid_argument &) {
+    }
+  }
+}
+
+/**
+ * @brief Tests that the compound operators work in place, return A, and
+ *        allow B to be A, and that moves leave the source zero.
+ */
+void test_compound_and_move() {
+  std::mt19937_64 rng(404);
+  std::uniform_int_distribution<long> value(-2000000000000000000,
+                                            2000000000000000000);
+  for (int i = 0; i < 200; i++) {
+    long a = value(rng) >> (rng() % 60), b = value(rng) >> (rng() % 60);
+    BigInteger A(a), B(b), C(a), D(a);
+    C += B;
+    D -= B;
+    expect(C == A + B, "A += B should match A + B");
+    expect(D == A - B, "A -= B should match A - B");
+  }
+
+  BigInteger A("123456789123456789123456789");
+  BigInteger B("-987654321");
+  BigInteger &R = (A += B);
+  expect(&R == &A, "operator+=() should return A");
+  expect(&(A -= B) == &A && &(A *= B) == &A && &(A /= B) == &A &&
+             &(A %= B) == &A,
+         "compound operators should return A");
+
+  BigInteger Z;
+  expect(Z + B == B && B + Z == B, "adding zero should be the identity");
+  expect(Z - B == BigInteger("987654321") && B - Z == B,
+         "subtracting zero");
+
+  BigInteger C("999999999999999999");
+  C += C;
+  expect(C.to_string() == "1999999999999999998", "C += C should double");
+  C -= C;
+  expect(C.sign() == 0, "C -= C should be zero");
+  C -= B;
+  expect(C.to_string() == "987654321", "0 - B should negate B");
+
+  // carries into a new limb, and borrows that empty the top limb
+  BigInteger D("999999999999999999"), E(1);
+  D += E;
+  expect(D.to_string() == "1000000000000000000", "carry into a new limb");
+  D -= E;
+  expect(D.to_string() == "999999999999999999", "borrow out of the top limb");
+  D -= BigInteger("1000000000000000001");
+  expect(D.to_string() == "-2", "sign flip on -=");
+
+  BigInteger F(std::move(D));
+  expect(F.to_string() == "-2" && D.sign() == 0, "move constructor");
+  D = std::move(F);
+  expect(D.to_string() == "-2" && F.sign() == 0, "move assignment");
+  F = D;
+  expect(F == D && F.to_string() == "-2", "copy assignment");
+}
+
+/**
+ * @brief Builds the binary form of a BigInteger from raw header fields and
+ *        limbs, to feed read() and BigIntegerView malformed input.
+ */
+std::string binary(int64_t sign, int64_t count, const Limbs &limbs) {
+  std::string bytes(reinterpret_cast<const char *>(&sign), sizeof(sign));
+  bytes.append(reinterpret_cast<const char *>(&count), sizeof(count));
+  bytes.append(reinterpret_cast<const char *>(limbs.data()),
+               limbs.size() * sizeof(long));
+  return bytes;
+}
+
+/**
+ * @brief Tests write() and read() round trips, rejection of malformed input,
+ *        and BigIntegerView over a written file.
+ */
+void test_serialization() {
+  std::string big = "-" + std::string(5000, '7') + "1";
+  const BigInteger values[] = {BigInteger(), BigInteger(1), BigInteger(-5),
+                               BigInteger(LONG_MIN),
+                               BigInteger("1000000000000000000"),
+                               BigInteger(big)};
+  for (const BigInteger &N : values) {
+    std::stringstream stream;
+    N.write(stream);
+    size_t digits = N.sign() == 0 ? 0 : N.chars_length() - (N.sign() < 0);
+    expect(stream.str().size() == 16 + 8 * ((digits + 8) / 9),
+           "write() should store 8 bytes per limb after a 16-byte header");
+    BigInteger M(42);
+    M.read(stream);
+    expect(M == N && M.to_string() == N.to_string(),
+           "read() should return the value written");
+  }
+
+  // several values back to back in one stream
+  std::stringstream stream;
+  for (const BigInteger &N : values) N.write(stream);
+  for (const BigInteger &N : values) {
+    BigInteger M;
+    M.read(stream);
+    expect(M == N, "consecutive read() calls should return each value");
+  }
+
+  const std::string malformed[] = {
+      binary(1, 1, {5}).substr(0, 10),     // truncated header
+      binary(1, 2, {5}),                   // truncated limbs
+      binary(2, 1, {5}),                   // bad sign
+      binary(0, 1, {5}),                   // zero with limbs
+      binary(1, 0, {}),                    // non-zero without limbs
+      binary(1, 1, {LIMB_BASE}),           // limb too large
+      binary(-1, 2, {5, 0}),               // leading zero limb
+      binary(1, -1, {}),                   // negative count
+  };
+  for (const std::string &bytes : malformed) {
+    std::istringstream input(bytes);
+    BigInteger M(42);
+    try {
+      M.read(input);
+      expect(false, "read() should reject malformed input");
+    } catch (const std::invalid_argument &) {
+    }
+    expect(M == BigInteger(42), "a failed read() should leave the value");
+  }
+
+  const std::string path = "BigIntegerTest.bin";
+  for (const BigInteger &N : values) {
+    {
+      std::ofstream file(path, std::ios::binary);
+      N.write(file);
+    }
+    BigIntegerView view(path);
+    expect(view.sign() == N.sign(), "view sign should match");
+    expect(view.value() == N, "view value should match");
+    BigIntegerView moved(std::move(view));
+    expect(moved.value() == N && view.size() == 0,
+           "moving a view should take over the mapping");
+  }
+  for (int i = 0; i < 3; i++) {
+    std::ofstream file(path, std::ios::binary);
+    const std::string &bytes = malformed[i];
+    file.write(bytes.data(), bytes.size());
+    file.close();
+    try {
+      BigIntegerView view(path);
+      expect(false, "BigIntegerView should reject a malformed file");
+    } catch (const std::invalid_argument &) {
+    }
+  }
+  // the constructor only checks the top limb; value() checks the rest
+  const std::string bad_limbs[] = {binary(1, 3, {5, LIMB_BASE, 7}),
+                                   binary(-1, 2, {-1, 7})};
+  for (const std::string &bytes : bad_limbs) {
+    {
+      std::ofstream file(path, std::ios::binary);
+      file.write(bytes.data(), bytes.size());
+    }
+    BigIntegerView view(path);
+    try {
+      view.value();
+      expect(false, "value() should reject a limb out of range");
+    } catch (const std::invalid_argument &) {
+    }
+  }
+  std::remove(path.c_str());
+  try {
+    BigIntegerView view(path);
+    expect(false, "BigIntegerView should reject a missing file");
+  } catch (const std::runtime_error &) {
+  }
+}
+
+/**
+ * @brief Tests LimbBuffer spilling to the heap, and BigInteger values on
+ *        either side of the inline limit.
+ */
+void test_small_buffer() {
+  LimbBuffer L;
+  expect(L.empty() && L.isInline(), "new LimbBuffer should be inline");
+  for (size_t i = 0; i < INLINE_LIMBS; i++) L.push_back(i + 1);
+  expect(L.isInline(), "INLINE_LIMBS limbs should stay inline");
+  L.push_back(7);
+  expect(!L.isInline() && L.size() == INLINE_LIMBS + 1 && L.back() == 7,
+         "one more limb should spill to the heap");
+  LimbBuffer M = L;
+  expect(M == L && !M.isInline(), "copy of a heap buffer");
+  LimbBuffer N = std::move(M);
+  expect(N == L && M.empty() && M.isInline(), "move of a heap buffer");
+  L.assign(L.data() + 1, L.size() - 1);
+  expect(L.size() == INLINE_LIMBS && L[0] == 2, "assign from itself");
+  L.resize(1);
+  M = std::move(L);
+  expect(M.size() == 1 && M[0] == 2 && L.empty(), "move of an inline buffer");
+  M.resize(3);
+  expect(M[1] == 0 && M[2] == 0, "resize() should zero new limbs");
+
+  expect(BigInteger(LONG_MAX).to_string() == std::to_string(LONG_MAX),
+         "LONG_MAX");
+  expect(BigInteger(LONG_MIN).to_string() == std::to_string(LONG_MIN),
+         "LONG_MIN");
+
+  // single limb fast paths, with and without a carry into a second limb
+  BigInteger A(999999999), B(1), C(-999999999);
+  expect((A + B).to_string() == "1000000000", "single limb carry");
+  expect((B + C).to_string() == "-999999998", "single limb sign change");
+  expect((A + C).sign() == 0, "single limb cancel");
+  expect((A * C).to_string() == "-999999998000000001", "single limb mult");
+
+  // products that just fit inline, and ones that spill
+  BigInteger D("999999999999999999");
+  BigInteger E = D * D;
+  expect(E.to_string() == "999999999999999998000000000000000001",
+         "four limb product");
+  E *= E;
+  expect(E.to_string() ==
+             "999999999999999996000000000000000005999999999999999996000000"
+             "000000000001",
+         "eight limb product");
+  E -= E * BigInteger(2);
+  E += E;
+  expect(E.to_string() ==
+             "-19999999999999999920000000000000000119999999999999999920000"
+             "00000000000002",
+         "compound operators on spilled values");
+}
+
 int add_test() {
   /*
    * Adding numbers fall into one of 4 cases, denote pos = positive number,
@@ -380,6 +942,15 @@ int main() {
   run_test(test_addition, "Testing Addition");
   run_test(test_subtraction, "Testing Subtraction");
   run_test(test_multiplication, "Testing Multiplication");
+  run_test(test_string_conversion, "Testing String Conversion");
+  run_test(test_compound_and_move, "Testing Compound Assignment and Moves");
+  run_test(test_small_buffer, "Testing Small Buffer");
+  run_test(test_serialization, "Testing Serialization");
+  run_test(test_simd_kernels, "Testing SIMD Kernels");
+  run_test(test_multiplication_kernels, "Testing Multiplication Kernels");
+  run_test(test_parallel_mult, "Testing Parallel Multiplication");
+  run_test(test_division_kernels, "Testing Division Kernels");
+  run_test(test_division, "Testing Division");
   run_specific_test(add_test, "ClassTest: Testing Addition");
   run_specific_test(add_assign_test, "ClassTest: Testing Addition Assign");
   run_specific_test(subtract_test, "ClassTest: Testing Subtraction");
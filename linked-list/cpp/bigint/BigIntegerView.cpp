@@ -0,0 +1,111 @@
+/**
+ * @author Ethan Okamura
+ * @file BigIntegerView.cpp
+ * @brief Implementation of the read-only view of a BigInteger stored in a
+ *        file by BigInteger::write()
+ * @status: working / tested
+ */
+
+#include "BigIntegerView.h"
+#include "Multiply.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+// Bytes before the first limb: the sign and the limb count.
+const size_t HEADER_BYTES = 2 * sizeof(int64_t);
+
+// Class Constructors & Destructors ----------------------------------------
+
+// BigIntegerView()
+// Maps the file at path, which holds one BigInteger written by
+// BigInteger::write(), without copying its limbs.
+BigIntegerView::BigIntegerView(const std::string &path)
+    : mapping(nullptr), mapped_length(0), signum(0), limbs(nullptr),
+      length(0) {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw std::runtime_error("BigIntegerView: cannot open " + path);
+  struct stat status;
+  if (fstat(fd, &status) != 0) {
+    close(fd);
+    throw std::runtime_error("BigIntegerView: cannot stat " + path);
+  }
+  mapped_length = static_cast<size_t>(status.st_size);
+  if (mapped_length < HEADER_BYTES) {
+    close(fd);
+    throw std::invalid_argument("BigIntegerView: missing header");
+  }
+  mapping = mmap(nullptr, mapped_length, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);  // the mapping keeps the file open
+  if (mapping == MAP_FAILED) {
+    mapping = nullptr;
+    throw std::runtime_error("BigIntegerView: cannot map " + path);
+  }
+
+  // BigInteger::write() lays out two 64-bit integers, then the limbs
+  int64_t header[2];
+  std::memcpy(header, mapping, HEADER_BYTES);
+  int64_t sign = header[0], count = header[1];
+  limbs = reinterpret_cast<const long *>(static_cast<const char *>(mapping) +
+                                         HEADER_BYTES);
+  size_t available = (mapped_length - HEADER_BYTES) / sizeof(long);
+  bool valid = sign >= -1 && sign <= 1 && (sign == 0) == (count == 0) &&
+               (mapped_length - HEADER_BYTES) % sizeof(long) == 0 &&
+               count >= 0 && static_cast<uint64_t>(count) == available;
+  if (valid && count > 0) {
+    long top = limbs[count - 1];
+    valid = top > 0 && top < LIMB_BASE;
+  }
+  if (!valid) {
+    munmap(mapping, mapped_length);
+    mapping = nullptr;
+    throw std::invalid_argument("BigIntegerView: malformed file " + path);
+  }
+  signum = static_cast<int>(sign);
+  length = static_cast<size_t>(count);
+}
+
+// BigIntegerView()
+// Takes over the mapping of V, leaving V an empty view of zero.
+BigIntegerView::BigIntegerView(BigIntegerView &&V)
+    : mapping(V.mapping), mapped_length(V.mapped_length), signum(V.signum),
+      limbs(V.limbs), length(V.length) {
+  V.mapping = nullptr;
+  V.mapped_length = 0;
+  V.signum = 0;
+  V.limbs = nullptr;
+  V.length = 0;
+}
+
+// Destructor
+// Unmaps the file.
+BigIntegerView::~BigIntegerView() {
+  if (mapping != nullptr) munmap(mapping, mapped_length);
+}
+
+// Access functions --------------------------------------------------------
+
+// value()
+// Returns the value as a BigInteger, with a single copy of the limbs. Each
+// limb is range-checked as it is copied, since the constructor only checked
+// the top one; throws std::invalid_argument on a limb outside [0, 10^9).
+BigInteger BigIntegerView::value() const {
+  BigInteger N;
+  N.digits.resize(length);
+  long *out = N.digits.data();
+  for (size_t i = 0; i < length; i++) {
+    long limb = limbs[i];
+    if (limb < 0 || limb >= LIMB_BASE)
+      throw std::invalid_argument("BigIntegerView: value(): limb out of range");
+    out[i] = limb;
+  }
+  N.signum = signum;
+  return N;
+}
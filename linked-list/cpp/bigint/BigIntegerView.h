@@ -0,0 +1,71 @@
+/**
+ * @author Ethan Okamura
+ * @file BigIntegerView.h
+ * @brief Header file for the read-only view of a BigInteger stored in a file
+ *        by BigInteger::write()
+ * @status: working / tested
+ */
+
+#include <cstddef>
+#include <string>
+
+#include "BigInteger.h"
+
+#ifndef BIG_INTEGER_VIEW_H_INCLUDE_
+#define BIG_INTEGER_VIEW_H_INCLUDE_
+
+// Exported type  -------------------------------------------------------------
+class BigIntegerView {
+ private:
+  // BigIntegerView Fields
+  void *mapping;         // the mapped file, or nullptr if empty
+  size_t mapped_length;  // length of the mapping in bytes
+  int signum;            // +1 (positive), -1 (negative), 0 (zero)
+  const long *limbs;     // base 10^9 limbs inside the mapping
+  size_t length;         // number of limbs
+
+ public:
+  // Class Constructors & Destructors ----------------------------------------
+
+  // BigIntegerView()
+  // Maps the file at path, which holds one BigInteger written by
+  // BigInteger::write(), without copying its limbs. Throws
+  // std::runtime_error if the file cannot be mapped, and
+  // std::invalid_argument if its header, length or top limb are malformed.
+  // The other limbs are not checked, so opening takes constant time.
+  explicit BigIntegerView(const std::string &path);
+
+  // BigIntegerView()
+  // Takes over the mapping of V, leaving V an empty view of zero.
+  BigIntegerView(BigIntegerView &&V);
+
+  BigIntegerView(const BigIntegerView &V) = delete;
+  BigIntegerView &operator=(const BigIntegerView &V) = delete;
+
+  // Destructor
+  // Unmaps the file.
+  ~BigIntegerView();
+
+  // Access functions --------------------------------------------------------
+
+  // sign()
+  // Returns -1, 1 or 0 according to whether the value is negative, positive
+  // or 0, respectively.
+  int sign() const { return signum; }
+
+  // size()
+  // Returns the number of limbs.
+  size_t size() const { return length; }
+
+  // data()
+  // Returns a pointer to the least significant limb in the mapping. The
+  // pointer is valid as long as this view.
+  const long *data() const { return limbs; }
+
+  // value()
+  // Returns the value as a BigInteger, with a single copy of the limbs.
+  // Throws std::invalid_argument if a limb is outside [0, 10^9).
+  BigInteger value() const;
+};
+
+#endif
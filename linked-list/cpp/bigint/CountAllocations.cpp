@@ -0,0 +1,33 @@
+/**
+ * @author Ethan Okamura
+ * @file CountAllocations.cpp
+ * @brief Replaces the global operator new and delete so that every heap
+ *        allocation in the program is counted. Only link into benchmarks.
+ */
+
+#include "CountAllocations.h"
+
+#include <cstdlib>
+#include <new>
+
+static size_t allocations = 0;
+
+void *operator new(std::size_t size) {
+  allocations++;
+  if (void *p = std::malloc(size)) return p;
+  throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) { return operator new(size); }
+
+void operator delete(void *p) noexcept { std::free(p); }
+
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+void operator delete[](void *p) noexcept { std::free(p); }
+
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+
+// allocationCount()
+// Returns the number of calls to operator new so far in this program.
+size_t allocationCount() { return allocations; }
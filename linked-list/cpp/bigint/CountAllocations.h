@@ -0,0 +1,17 @@
+/**
+ * @author Ethan Okamura
+ * @file CountAllocations.h
+ * @brief Header file for the global operator new replacement that counts
+ *        heap allocations in the benchmarks
+ */
+
+#include <cstddef>
+
+#ifndef COUNT_ALLOCATIONS_H_INCLUDE_
+#define COUNT_ALLOCATIONS_H_INCLUDE_
+
+// allocationCount()
+// Returns the number of calls to operator new so far in this program.
+size_t allocationCount();
+
+#endif
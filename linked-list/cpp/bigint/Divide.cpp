@@ -0,0 +1,289 @@
+/**
+ * @author Ethan Okamura
+ * @file Divide.cpp
+ * @brief Implementation of the limb division and modular exponentiation
+ *        kernels
+ * @status: working / tested
+ */
+
+#include "Divide.h"
+#include "SimdLimbs.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+// Precision (in limbs) at or below which approxReciprocal() stops recursing
+// and divides directly.
+const size_t RECIPROCAL_BASE_CASE = 16;
+
+// Helpers -----------------------------------------------------------------
+
+// powerOfBase()
+// Returns LIMB_BASE^k.
+Limbs powerOfBase(size_t k) {
+  Limbs P(k + 1);
+  P[k] = 1;
+  return P;
+}
+
+// shiftUp()
+// Returns L * LIMB_BASE^k.
+Limbs shiftUp(const Limbs &L, size_t k) {
+  if (L.empty()) return L;
+  Limbs S(k, 0);
+  S.insert(S.end(), L.begin(), L.end());
+  return S;
+}
+
+// shiftDown()
+// Returns floor(L / LIMB_BASE^k).
+Limbs shiftDown(const Limbs &L, size_t k) {
+  return sliceLimbs(L, k, L.size());
+}
+
+// scaleLimbs()
+// Returns L * m for 0 < m < LIMB_BASE.
+Limbs scaleLimbs(const Limbs &L, long m) {
+  Limbs S(L.size() + 1);
+  S[L.size()] = scaleLimbsN(S.data(), L.data(), L.size(), m);
+  trimLimbs(S);
+  return S;
+}
+
+// shortDivmod()
+// Returns L / d and overwrites rem with L % d, for 0 < d < LIMB_BASE.
+Limbs shortDivmod(const Limbs &L, long d, long &rem) {
+  Limbs Q(L.size());
+  rem = 0;
+  for (size_t i = L.size(); i-- > 0;) {
+    long value = rem * LIMB_BASE + L[i];
+    Q[i] = value / d;
+    rem = value % d;
+  }
+  trimLimbs(Q);
+  return Q;
+}
+
+// approxReciprocal()
+// Returns an approximation of LIMB_BASE^(V.size() + p) / V that is within a
+// few units. Only the top p + 2 limbs of V are used, and each Newton step
+// doubles the precision of the reciprocal from the level below it.
+Limbs approxReciprocal(const Limbs &V, size_t p) {
+  size_t t = std::min(V.size(), p + 2);
+  Limbs Vt = sliceLimbs(V, V.size() - t, t);
+  if (p <= RECIPROCAL_BASE_CASE) {
+    Limbs Q, R;
+    knuthDivmod(powerOfBase(t + p), Vt, Q, R);
+    return Q;
+  }
+
+  // Xh ~ LIMB_BASE^(t+h) / Vt
+  size_t h = p / 2 + 1;
+  Limbs Xh = approxReciprocal(Vt, h);
+
+  // X = Xh*LIMB_BASE^(p-h) + Xh*(LIMB_BASE^(t+h) - Vt*Xh) / LIMB_BASE^s
+  size_t s = t + 2 * h - p;
+  Limbs X = shiftUp(Xh, p - h);
+  Limbs P = powerOfBase(t + h);
+  Limbs VX = multLimbs(Vt, Xh);
+  if (compareLimbs(P, VX) >= 0) {
+    X = addLimbs(X, shiftDown(multLimbs(Xh, subLimbs(P, VX)), s));
+  } else {
+    X = subLimbs(X, shiftDown(multLimbs(Xh, subLimbs(VX, P)), s));
+  }
+  return X;
+}
+
+// toBinaryChunks()
+// Returns E in base 2^30, least significant chunk first.
+std::vector<long> toBinaryChunks(Limbs E) {
+  std::vector<long> chunks;
+  while (!E.empty()) {
+    long rem;
+    E = shortDivmod(E, 1L << 30, rem);
+    chunks.push_back(rem);
+  }
+  return chunks;
+}
+
+// Division kernels --------------------------------------------------------
+
+// knuthDivmod()
+// Overwrites Q and R with the quotient and remainder of A / B using Knuth's
+// algorithm D (TAOCP vol. 2, 4.3.1).
+// pre: B is non-zero
+void knuthDivmod(const Limbs &A, const Limbs &B, Limbs &Q, Limbs &R) {
+  if (B.empty())
+    throw std::domain_error("Divide: knuthDivmod(): division by zero");
+  if (compareLimbs(A, B) < 0) {
+    Q.clear();
+    R = A;
+    return;
+  }
+  if (B.size() == 1) {
+    long rem;
+    Q = shortDivmod(A, B[0], rem);
+    R = rem ? Limbs{rem} : Limbs();
+    return;
+  }
+
+  // D1: normalize so the top limb of the divisor is at least LIMB_BASE/2
+  size_t n = B.size(), m = A.size() - n;
+  long d = LIMB_BASE / (B[n - 1] + 1);
+  Limbs U = scaleLimbs(A, d), V = scaleLimbs(B, d);
+  U.resize(A.size() + 1);
+
+  Q.assign(m + 1, 0);
+  Limbs product(n + 1);
+  for (size_t j = m + 1; j-- > 0;) {
+    // D3: estimate qhat from the top two limbs, correct with the third
+    long num = U[j + n] * LIMB_BASE + U[j + n - 1];
+    long qhat = num / V[n - 1];
+    long rhat = num % V[n - 1];
+    while (qhat >= LIMB_BASE ||
+           qhat * V[n - 2] > rhat * LIMB_BASE + U[j + n - 2]) {
+      qhat--;
+      rhat += V[n - 1];
+      if (rhat >= LIMB_BASE) break;
+    }
+
+    // D4: multiply and subtract
+    product[n] = scaleLimbsN(product.data(), V.data(), n, qhat);
+    long borrow = subLimbsN(&U[j], &U[j], product.data(), n + 1);
+
+    // D6: qhat was one too large, add back
+    if (borrow) {
+      qhat--;
+      long carry = addLimbsN(&U[j], &U[j], V.data(), n);
+      U[j + n] = (U[j + n] + carry) % LIMB_BASE;
+    }
+    Q[j] = qhat;
+  }
+  trimLimbs(Q);
+
+  // D8: unnormalize the remainder
+  U.resize(n);
+  trimLimbs(U);
+  long rem;
+  R = shortDivmod(U, d, rem);
+}
+
+// reciprocalLimbs()
+// Returns floor(LIMB_BASE^m / B), found by Newton iteration with doubling
+// precision and corrected to be exact.
+// pre: B is non-zero, m >= B.size()
+Limbs reciprocalLimbs(const Limbs &B, size_t m) {
+  if (B.empty())
+    throw std::domain_error("Divide: reciprocalLimbs(): division by zero");
+  if (m < B.size())
+    throw std::logic_error("Divide: reciprocalLimbs(): m < B.size()");
+  Limbs X = approxReciprocal(B, m - B.size());
+
+  // the error is a few units, so these divisions are O(B.size())
+  Limbs P = powerOfBase(m);
+  Limbs BX = multLimbs(B, X);
+  Limbs q, r;
+  if (compareLimbs(BX, P) > 0) {
+    knuthDivmod(subLimbs(BX, P), B, q, r);
+    if (!r.empty()) q = addLimbs(q, Limbs{1});
+    X = subLimbs(X, q);
+  } else {
+    knuthDivmod(subLimbs(P, BX), B, q, r);
+    X = addLimbs(X, q);
+  }
+  return X;
+}
+
+// newtonDivmod()
+// Overwrites Q and R with the quotient and remainder of A / B by multiplying
+// A with the reciprocal of B.
+// pre: B is non-zero
+void newtonDivmod(const Limbs &A, const Limbs &B, Limbs &Q, Limbs &R) {
+  if (B.empty())
+    throw std::domain_error("Divide: newtonDivmod(): division by zero");
+  if (compareLimbs(A, B) < 0) {
+    Q.clear();
+    R = A;
+    return;
+  }
+  // Q = floor(A * floor(LIMB_BASE^m / B) / LIMB_BASE^m) is at most two
+  // below the true quotient, and never above it
+  size_t m = A.size();
+  Q = shiftDown(multLimbs(A, reciprocalLimbs(B, m)), m);
+  R = subLimbs(A, multLimbs(Q, B));
+  while (compareLimbs(R, B) >= 0) {
+    R = subLimbs(R, B);
+    Q = addLimbs(Q, Limbs{1});
+  }
+}
+
+// divmodLimbs()
+// Overwrites Q and R with the quotient and remainder of A / B, choosing
+// Knuth's algorithm D or a Newton reciprocal by operand size.
+// pre: B is non-zero
+void divmodLimbs(const Limbs &A, const Limbs &B, Limbs &Q, Limbs &R,
+                 size_t newton_cutoff) {
+  // algorithm D costs O(B.size() * quotient length), so the reciprocal only
+  // pays off when both are long
+  size_t quotient = A.size() >= B.size() ? A.size() - B.size() + 1 : 0;
+  if (B.size() > newton_cutoff && quotient > newton_cutoff) {
+    newtonDivmod(A, B, Q, R);
+  } else {
+    knuthDivmod(A, B, Q, R);
+  }
+}
+
+// Modular reduction -------------------------------------------------------
+
+// makeReducer()
+// Returns a ModReducer for the modulus M.
+// pre: M is non-zero
+ModReducer makeReducer(const Limbs &M, size_t barrett_cutoff) {
+  if (M.empty())
+    throw std::domain_error("Divide: makeReducer(): zero modulus");
+  ModReducer reducer{M, Limbs()};
+  if (M.size() > barrett_cutoff) {
+    reducer.inverse = reciprocalLimbs(M, 2 * M.size());
+  }
+  return reducer;
+}
+
+// reduceLimbs()
+// Returns A mod reducer.M.
+Limbs reduceLimbs(const Limbs &A, const ModReducer &reducer) {
+  const Limbs &M = reducer.M;
+  if (compareLimbs(A, M) < 0) return A;
+  Limbs Q, R;
+  // Barrett reduction only holds for A < LIMB_BASE^(2*M.size())
+  if (reducer.inverse.empty() || A.size() > 2 * M.size()) {
+    knuthDivmod(A, M, Q, R);
+    return R;
+  }
+  // only the top k+1 limbs of A matter for the quotient estimate, which is
+  // at most two below the true quotient (HAC 14.42)
+  size_t k = M.size();
+  Q = shiftDown(multLimbs(shiftDown(A, k - 1), reducer.inverse), k + 1);
+  R = subLimbs(A, multLimbs(Q, M));
+  while (compareLimbs(R, M) >= 0) R = subLimbs(R, M);
+  return R;
+}
+
+// powmodLimbs()
+// Returns B^E mod M by left-to-right binary exponentiation.
+// pre: M is non-zero
+Limbs powmodLimbs(const Limbs &B, const Limbs &E, const Limbs &M,
+                  size_t barrett_cutoff) {
+  ModReducer reducer = makeReducer(M, barrett_cutoff);
+  Limbs base = reduceLimbs(B, reducer);
+  Limbs result = reduceLimbs(Limbs{1}, reducer);
+  std::vector<long> chunks = toBinaryChunks(E);
+  for (size_t i = chunks.size(); i-- > 0;) {
+    for (int bit = 29; bit >= 0; bit--) {
+      result = reduceLimbs(multLimbs(result, result), reducer);
+      if ((chunks[i] >> bit) & 1) {
+        result = reduceLimbs(multLimbs(result, base), reducer);
+      }
+    }
+  }
+  return result;
+}
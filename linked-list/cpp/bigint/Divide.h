@@ -0,0 +1,73 @@
+/**
+ * @author Ethan Okamura
+ * @file Divide.h
+ * @brief Header file for the limb division and modular exponentiation
+ *        kernels used by BigInteger
+ * @status: working / tested
+ */
+
+#include "Multiply.h"
+
+#ifndef DIVIDE_H_INCLUDE_
+#define DIVIDE_H_INCLUDE_
+
+// Cutoffs found with PowModTrials (read README.md)
+// Divisor length (in limbs) above which divmodLimbs() uses a Newton
+// reciprocal instead of Knuth's algorithm D.
+const size_t NEWTON_CUTOFF = 2000;
+// Modulus length (in limbs) above which a ModReducer precomputes a reciprocal
+// and uses Barrett reduction instead of Knuth's algorithm D.
+const size_t BARRETT_CUTOFF = 275;
+
+// Division kernels -----------------------------------------------------------
+
+// knuthDivmod()
+// Overwrites Q and R with the quotient and remainder of A / B using Knuth's
+// algorithm D (TAOCP vol. 2, 4.3.1).
+// pre: B is non-zero
+void knuthDivmod(const Limbs &A, const Limbs &B, Limbs &Q, Limbs &R);
+
+// reciprocalLimbs()
+// Returns floor(LIMB_BASE^m / B), found by Newton iteration with doubling
+// precision and corrected to be exact.
+// pre: B is non-zero, m >= B.size()
+Limbs reciprocalLimbs(const Limbs &B, size_t m);
+
+// newtonDivmod()
+// Overwrites Q and R with the quotient and remainder of A / B by multiplying
+// A with the reciprocal of B.
+// pre: B is non-zero
+void newtonDivmod(const Limbs &A, const Limbs &B, Limbs &Q, Limbs &R);
+
+// divmodLimbs()
+// Overwrites Q and R with the quotient and remainder of A / B, choosing
+// Knuth's algorithm D or a Newton reciprocal by operand size.
+// pre: B is non-zero
+void divmodLimbs(const Limbs &A, const Limbs &B, Limbs &Q, Limbs &R,
+                 size_t newton_cutoff = NEWTON_CUTOFF);
+
+// Modular reduction ----------------------------------------------------------
+
+// Reduces values modulo a fixed M. Above the Barrett cutoff this is Barrett
+// reduction with a precomputed reciprocal, otherwise Knuth's algorithm D.
+struct ModReducer {
+  Limbs M;        // modulus
+  Limbs inverse;  // floor(LIMB_BASE^(2*M.size()) / M), empty for Knuth
+};
+
+// makeReducer()
+// Returns a ModReducer for the modulus M.
+// pre: M is non-zero
+ModReducer makeReducer(const Limbs &M, size_t barrett_cutoff = BARRETT_CUTOFF);
+
+// reduceLimbs()
+// Returns A mod reducer.M.
+Limbs reduceLimbs(const Limbs &A, const ModReducer &reducer);
+
+// powmodLimbs()
+// Returns B^E mod M by left-to-right binary exponentiation.
+// pre: M is non-zero
+Limbs powmodLimbs(const Limbs &B, const Limbs &E, const Limbs &M,
+                  size_t barrett_cutoff = BARRETT_CUTOFF);
+
+#endif
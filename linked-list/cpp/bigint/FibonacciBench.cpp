@@ -0,0 +1,73 @@
+/**
+ * @author Ethan Okamura
+ * @file FibonacciBench.cpp
+ * @brief Counts heap allocations and time spent computing F(n) with
+ *        temporaries versus in-place compound assignment (read README.md)
+ */
+
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <utility>
+
+#include "BigInteger.h"
+#include "CountAllocations.h"
+
+/**
+ * @brief F(n) with a fresh temporary for every sum.
+ * @param n The index of the Fibonacci number.
+ */
+BigInteger fibonacci_temporaries(int n) {
+  BigInteger a(0), b(1);
+  for (int i = 0; i < n; i++) {
+    BigInteger c = a + b;
+    a = b;
+    b = c;
+  }
+  return a;
+}
+
+/**
+ * @brief F(n) with in-place addition and swaps.
+ * @param n The index of the Fibonacci number.
+ */
+BigInteger fibonacci_in_place(int n) {
+  BigInteger a(0), b(1);
+  for (int i = 0; i < n; i++) {
+    a += b;
+    std::swap(a, b);
+  }
+  return a;
+}
+
+/**
+ * @brief Runs one variant and reports its allocations and time.
+ * @param name The name of the variant.
+ * @param fibonacci The variant to run.
+ * @param n The index of the Fibonacci number.
+ */
+BigInteger run(const char *name, BigInteger (*fibonacci)(int), int n) {
+  size_t before = allocationCount();
+  std::clock_t time = std::clock();  // start
+  BigInteger F = fibonacci(n);
+  time = std::clock() - time;  // stop
+  size_t count = allocationCount() - before;
+  std::cout << name << ": " << count << " allocations ("
+            << static_cast<double>(count) / n << " per step), "
+            << static_cast<double>(time) / CLOCKS_PER_SEC << " s\n";
+  return F;
+}
+
+int main(int argc, char **argv) {
+  int n = argc > 1 ? std::atoi(argv[1]) : 100000;
+  std::cout << "F(" << n << ")\n";
+  BigInteger A = run("temporaries", fibonacci_temporaries, n);
+  BigInteger B = run("in place", fibonacci_in_place, n);
+  if (!(A == B)) {
+    std::cerr << "FibonacciBench: results differ\n";
+    return EXIT_FAILURE;
+  }
+  std::cout << "digits: " << A.to_string().length() << '\n';
+  return EXIT_SUCCESS;
+}
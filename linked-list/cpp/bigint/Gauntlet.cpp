@@ -0,0 +1,84 @@
+/**
+ * @author Ethan Okamura
+ * @file Gauntlet.cpp
+ * @brief Implementation of the gauntlet of arithmetic operations
+ * @status: working / tested
+ */
+
+#include "Gauntlet.h"
+
+#include <stdexcept>
+
+/**
+ * @brief Handles operations between 2 BigInts
+ * @param A The first BigInt ADT.
+ * @param B The second BigInt ADT.
+ * @param code The operation code (from enum).
+ */
+BigInteger arithmetic_gauntlet(const BigInteger &A, const BigInteger &B,
+                               Test code) {
+  BigInteger C(1);
+  BigInteger D(1);
+  switch (code) {
+    case Test::TEST_1:
+      return A;
+    case Test::TEST_2:
+      return B;
+    case Test::TEST_3:
+      return A + B;
+    case Test::TEST_4:
+      return A - B;
+    case Test::TEST_5:
+      return A - A;
+    case Test::TEST_6:
+      return (3 * A) - (2 * B);
+    case Test::TEST_7:
+      return A * B;
+    case Test::TEST_8:
+      return A * A;
+    case Test::TEST_9:
+      return B * B;
+    case Test::TEST_10:
+      for (int i = 0; i < 4; i++) {
+        C *= A;
+      }
+      for (int i = 0; i < 5; i++) {
+        D *= B;
+      }
+      return (9 * C) + (16 * D);
+    default:
+      // Basic error handling
+      throw std::logic_error("Arithmetic: Invalid test");
+  }
+}
+
+/**
+ * @brief Returns a short name for the operation a test performs.
+ * @param code The operation code (from enum).
+ */
+const char *gauntlet_name(Test code) {
+  switch (code) {
+    case Test::TEST_1:
+      return "copy_a";  // A
+    case Test::TEST_2:
+      return "copy_b";  // B
+    case Test::TEST_3:
+      return "add";  // A + B
+    case Test::TEST_4:
+      return "sub";  // A - B
+    case Test::TEST_5:
+      return "sub_self";  // A - A
+    case Test::TEST_6:
+      return "scale_sub";  // 3A - 2B
+    case Test::TEST_7:
+      return "mult";  // A * B
+    case Test::TEST_8:
+      return "square_a";  // A * A
+    case Test::TEST_9:
+      return "square_b";  // B * B
+    case Test::TEST_10:
+      return "power_sum";  // 9A^4 + 16B^5
+    default:
+      throw std::logic_error("Arithmetic: Invalid test");
+  }
+}
@@ -0,0 +1,52 @@
+/**
+ * @author Ethan Okamura
+ * @file Gauntlet.h
+ * @brief Header file for the gauntlet of arithmetic operations shared by
+ *        Arithmetic and GauntletBench
+ * @status: working / tested
+ */
+
+#include <array>
+
+#include "BigInteger.h"
+
+#ifndef GAUNTLET_H_INCLUDE_
+#define GAUNTLET_H_INCLUDE_
+
+/// @brief Test cases enum to help consistency
+enum class Test {
+  TEST_1,
+  TEST_2,
+  TEST_3,
+  TEST_4,
+  TEST_5,
+  TEST_6,
+  TEST_7,
+  TEST_8,
+  TEST_9,
+  TEST_10
+};
+
+/// @brief Every test, in the order Arithmetic writes them
+const std::array<Test, 10> GAUNTLET_TESTS = {
+    Test::TEST_1, Test::TEST_2, Test::TEST_3, Test::TEST_4, Test::TEST_5,
+    Test::TEST_6, Test::TEST_7, Test::TEST_8, Test::TEST_9, Test::TEST_10,
+};
+
+/**
+ * @brief Handles operations between 2 BigInts
+ * @param A The first BigInt ADT.
+ * @param B The second BigInt ADT.
+ * @param code The operation code (from enum).
+ */
+BigInteger arithmetic_gauntlet(const BigInteger &A, const BigInteger &B,
+                               Test code);
+
+/**
+ * @brief Returns a short name for the operation a test performs, such as
+ *        "add" for A + B.
+ * @param code The operation code (from enum).
+ */
+const char *gauntlet_name(Test code);
+
+#endif
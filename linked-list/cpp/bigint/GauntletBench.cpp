@@ -0,0 +1,91 @@
+/**
+ * @author Ethan Okamura
+ * @file GauntletBench.cpp
+ * @brief Times every Arithmetic gauntlet operation, plus decimal parsing and
+ *        printing, on operands from 10 to 10^6 digits and writes the results
+ *        as CSV (read README.md)
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "BigInteger.h"
+#include "CountAllocations.h"
+#include "Gauntlet.h"
+
+// Minimum CPU time spent on each operation, in seconds.
+const double MIN_SECONDS = 0.2;
+
+/**
+ * @brief Returns a random decimal string of the given number of digits.
+ */
+std::string random_digits(size_t digits, std::mt19937_64 &rng) {
+  std::string s(digits, '0');
+  for (char &c : s) c = static_cast<char>('0' + rng() % 10);
+  s[0] = static_cast<char>('1' + rng() % 9);
+  return s;
+}
+
+/**
+ * @brief Repeats op until MIN_SECONDS have passed, then writes one CSV row.
+ * @param digits The number of digits in each operand.
+ * @param name The operation column.
+ * @param limbs The input limbs one call of op processes.
+ * @param op Runs the operation once.
+ */
+template <typename Op>
+void bench(size_t digits, const char *name, size_t limbs, Op op) {
+  long runs = 0;
+  size_t allocations = allocationCount();
+  std::clock_t time = std::clock();  // start
+  std::clock_t stop = time + static_cast<std::clock_t>(MIN_SECONDS *
+                                                         CLOCKS_PER_SEC);
+  do {
+    op();
+    runs++;
+  } while (std::clock() < stop);
+  time = std::clock() - time;  // stop
+  allocations = allocationCount() - allocations;
+
+  double seconds = static_cast<double>(time) / CLOCKS_PER_SEC / runs;
+  std::cout << digits << ',' << name << ',' << runs << ','
+            << seconds * 1e9 << ','
+            << static_cast<double>(allocations) / runs << ','
+            << limbs / seconds << '\n';
+}
+
+int main(int argc, char **argv) {
+  size_t max_digits =
+      argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+  std::mt19937_64 rng(max_digits);
+
+  std::cout << "digits,operation,runs,ns_per_op,allocations_per_op,"
+               "limbs_per_sec\n";
+  for (size_t digits = 10; digits <= max_digits; digits *= 10) {
+    std::string a = random_digits(digits, rng);
+    std::string b = "-" + random_digits(digits, rng);
+    BigInteger A(a), B(b);
+    const size_t limbs = (digits + 8) / 9;
+
+    // conversions
+    bench(digits, "parse", limbs, [&] { A = BigInteger(a); });
+    std::string out;
+    bench(digits, "to_string", limbs, [&] { out = A.to_string(); });
+    if (out != a) {
+      std::cerr << "GauntletBench: to_string() differs from input\n";
+      return EXIT_FAILURE;
+    }
+
+    // gauntlet operations, on both operands
+    for (Test test : GAUNTLET_TESTS) {
+      BigInteger R;
+      bench(digits, gauntlet_name(test), 2 * limbs,
+            [&] { R = arithmetic_gauntlet(A, B, test); });
+    }
+  }
+  return EXIT_SUCCESS;
+}
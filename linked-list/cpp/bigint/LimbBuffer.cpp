@@ -0,0 +1,116 @@
+/**
+ * @author Ethan Okamura
+ * @file LimbBuffer.cpp
+ * @brief Implementation of the small-buffer limb storage of BigInteger
+ * @status: working / tested
+ */
+
+#include "LimbBuffer.h"
+
+#include <algorithm>
+#include <utility>
+
+// Class Constructors & Destructors ----------------------------------------
+
+// LimbBuffer()
+// Creates a new LimbBuffer in the empty state, without allocating.
+LimbBuffer::LimbBuffer()
+    : limbs(small), length(0), capacity(INLINE_LIMBS), small() {}
+
+// LimbBuffer()
+// Creates a copy of L. Only allocates if L does not fit inline.
+LimbBuffer::LimbBuffer(const LimbBuffer &L) : LimbBuffer() {
+  assign(L.limbs, L.length);
+}
+
+// LimbBuffer()
+// Takes over the limbs of L, leaving L empty.
+LimbBuffer::LimbBuffer(LimbBuffer &&L) noexcept : LimbBuffer() {
+  *this = std::move(L);
+}
+
+// Destructor
+LimbBuffer::~LimbBuffer() {
+  if (!isInline()) delete[] limbs;
+}
+
+// Helpers -----------------------------------------------------------------
+
+// grow()
+// Moves the limbs to a heap array with room for at least n limbs.
+void LimbBuffer::grow(size_t n) {
+  size_t new_capacity = std::max(n, 2 * capacity);
+  long *heap = new long[new_capacity];
+  std::copy(limbs, limbs + length, heap);
+  if (!isInline()) delete[] limbs;
+  limbs = heap;
+  capacity = new_capacity;
+}
+
+// Manipulation procedures -------------------------------------------------
+
+// resize()
+// Changes the number of limbs to n. New limbs are zero.
+void LimbBuffer::resize(size_t n) {
+  if (n > capacity) grow(n);
+  if (n > length) std::fill(limbs + length, limbs + n, 0);
+  length = n;
+}
+
+// push_back()
+// Appends a new most significant limb.
+void LimbBuffer::push_back(long limb) {
+  if (length == capacity) grow(length + 1);
+  limbs[length++] = limb;
+}
+
+// assign()
+// Overwrites the limbs with the n limbs starting at first.
+void LimbBuffer::assign(const long *first, size_t n) {
+  // first may point into this buffer, so it is copied before growing
+  if (n > capacity) {
+    long *heap = new long[n];
+    std::copy(first, first + n, heap);
+    if (!isInline()) delete[] limbs;
+    limbs = heap;
+    capacity = n;
+  } else {
+    std::copy(first, first + n, limbs);
+  }
+  length = n;
+}
+
+// Overriden Operators -----------------------------------------------------
+
+// operator=()
+// Overwrites the state of this LimbBuffer with the state of L.
+LimbBuffer &LimbBuffer::operator=(const LimbBuffer &L) {
+  if (this != &L) assign(L.limbs, L.length);
+  return *this;
+}
+
+// operator=()
+// Takes over the limbs of L, leaving L empty.
+LimbBuffer &LimbBuffer::operator=(LimbBuffer &&L) noexcept {
+  if (this == &L) return *this;
+  if (L.isInline()) {
+    // nothing to steal, copying two limbs is cheaper
+    assign(L.limbs, L.length);
+  } else {
+    if (!isInline()) delete[] limbs;
+    limbs = L.limbs;
+    capacity = L.capacity;
+    length = L.length;
+    L.limbs = L.small;
+    L.capacity = INLINE_LIMBS;
+  }
+  L.length = 0;
+  return *this;
+}
+
+// operator==()
+// Returns true if and only if A and B hold the same limbs.
+bool operator==(const LimbBuffer &A, const LimbBuffer &B) {
+  return A.length == B.length &&
+         std::equal(A.limbs, A.limbs + A.length, B.limbs);
+}
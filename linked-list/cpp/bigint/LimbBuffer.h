@@ -0,0 +1,118 @@
+/**
+ * @author Ethan Okamura
+ * @file LimbBuffer.h
+ * @brief Header file for the contiguous limb storage of BigInteger, which
+ *        keeps small values inline and only spills larger ones to the heap
+ * @status: working / tested
+ */
+
+#include <cstddef>
+
+#ifndef LIMB_BUFFER_H_INCLUDE_
+#define LIMB_BUFFER_H_INCLUDE_
+
+// Number of limbs stored inside the LimbBuffer itself. Four limbs hold the
+// product of any two values below 10^18, so arithmetic on those never
+// allocates.
+const size_t INLINE_LIMBS = 4;
+
+// Exported type  -------------------------------------------------------------
+class LimbBuffer {
+ private:
+  // LimbBuffer Fields
+  long *limbs;               // small, or a heap array of capacity limbs
+  size_t length;             // number of limbs in use
+  size_t capacity;           // number of limbs limbs can hold
+  long small[INLINE_LIMBS];  // inline storage
+
+  // grow()
+  // Moves the limbs to a heap array with room for at least n limbs.
+  void grow(size_t n);
+
+ public:
+  // Class Constructors & Destructors ----------------------------------------
+
+  // LimbBuffer()
+  // Creates a new LimbBuffer in the empty state, without allocating.
+  LimbBuffer();
+
+  // LimbBuffer()
+  // Creates a copy of L. Only allocates if L does not fit inline.
+  LimbBuffer(const LimbBuffer &L);
+
+  // LimbBuffer()
+  // Takes over the limbs of L, leaving L empty.
+  LimbBuffer(LimbBuffer &&L) noexcept;
+
+  // Destructor
+  ~LimbBuffer();
+
+  // Access functions --------------------------------------------------------
+
+  // size()
+  // Returns the number of limbs in this LimbBuffer.
+  size_t size() const { return length; }
+
+  // empty()
+  // Returns true if this LimbBuffer has no limbs.
+  bool empty() const { return length == 0; }
+
+  // isInline()
+  // Returns true if the limbs are stored inside this LimbBuffer.
+  bool isInline() const { return limbs == small; }
+
+  // data()
+  // Returns a pointer to the least significant limb.
+  long *data() { return limbs; }
+  const long *data() const { return limbs; }
+
+  // operator[]()
+  // Returns limb i, least significant first.
+  // pre: i < size()
+  long &operator[](size_t i) { return limbs[i]; }
+  long operator[](size_t i) const { return limbs[i]; }
+
+  // back()
+  // Returns the most significant limb.
+  // pre: !empty()
+  long back() const { return limbs[length - 1]; }
+
+  // Manipulation procedures -------------------------------------------------
+
+  // clear()
+  // Removes every limb, keeping any heap array for reuse.
+  void clear() { length = 0; }
+
+  // resize()
+  // Changes the number of limbs to n. New limbs are zero.
+  void resize(size_t n);
+
+  // push_back()
+  // Appends a new most significant limb.
+  void push_back(long limb);
+
+  // pop_back()
+  // Removes the most significant limb.
+  // pre: !empty()
+  void pop_back() { length--; }
+
+  // assign()
+  // Overwrites the limbs with the n limbs starting at first.
+  void assign(const long *first, size_t n);
+
+  // Overriden Operators -----------------------------------------------------
+
+  // operator=()
+  // Overwrites the state of this LimbBuffer with the state of L.
+  LimbBuffer &operator=(const LimbBuffer &L);
+
+  // operator=()
+  // Takes over the limbs of L, leaving L empty.
+  LimbBuffer &operator=(LimbBuffer &&L) noexcept;
+
+  // operator==()
+  // Returns true if and only if A and B hold the same limbs.
+  friend bool operator==(const LimbBuffer &A, const LimbBuffer &B);
+};
+
+#endif
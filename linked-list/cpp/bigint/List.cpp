@@ -8,6 +8,7 @@
 #include "List.h"
 
 #include <unordered_map>
+#include <utility>
 
 List::Node::Node(ListElement x) : data(x), next(nullptr), prev(nullptr) {}
 
@@ -30,6 +31,10 @@ List::List(const List &L) : List() {
   }
 }
 
+// Move constructor. Leaves L in the empty state, with the two dummy nodes
+// this List starts with; running out of memory for those ends the program.
+List::List(List &&L) noexcept : List() { *this = std::move(L); }
+
 // Destructor
 List::~List() {
   Node *current = frontDummy;
@@ -340,6 +345,17 @@ bool List::equals(const List &R) const {
   return true;
 }
 
+// toArray()
+// Copies the elements of this List, front to back, into out. The cursor in
+// this List is unchanged.
+// pre: out has room for length() elements
+void List::toArray(ListElement *out) const {
+  for (Node *current = frontDummy->next; current != backDummy;
+       current = current->next) {
+    *out++ = current->data;
+  }
+}
+
 // Overriden Operators -----------------------------------------------------
 
 // operator<<()
@@ -367,3 +383,17 @@ List &List::operator=(const List &L) {
   }
   return *this;
 }
+
+// operator=()
+// Takes over the nodes of L in O(1). L is left in a valid state.
+List &List::operator=(List &&L) noexcept {
+  if (this != &L) {
+    std::swap(frontDummy, L.frontDummy);
+    std::swap(backDummy, L.backDummy);
+    std::swap(afterCursor, L.afterCursor);
+    std::swap(beforeCursor, L.beforeCursor);
+    std::swap(pos_cursor, L.pos_cursor);
+    std::swap(num_elements, L.num_elements);
+  }
+  return *this;
+}
@@ -43,6 +43,9 @@ class List {
   // Copy constructor.
   List(const List &L);
 
+  // Move constructor. Leaves L in the empty state.
+  List(List &&L) noexcept;
+
   // Destructor
   ~List();
 
@@ -171,6 +174,12 @@ class List {
   // The cursors in this List and in R are unchanged.
   bool equals(const List &R) const;
 
+  // toArray()
+  // Copies the elements of this List, front to back, into out. The cursor in
+  // this List is unchanged.
+  // pre: out has room for length() elements
+  void toArray(ListElement *out) const;
+
   // Overriden Operators -----------------------------------------------------
 
   // operator<<()
@@ -185,6 +194,10 @@ class List {
   // operator=()
   // Overwrites the state of this List with state of L.
   List &operator=(const List &L);
+
+  // operator=()
+  // Takes over the nodes of L in O(1). L is left in a valid state.
+  List &operator=(List &&L) noexcept;
 };
 
 #endif
\ No newline at end of file
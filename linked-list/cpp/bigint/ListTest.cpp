@@ -188,6 +188,21 @@ void testToStringAndEquals() {
   cout << "to_string() and equals() tests passed." << endl << endl;
 }
 
+void testToArray() {
+  cout << "=== Test toArray() ===" << endl;
+  List L;
+  for (int i = 1; i <= 4; i++) {
+    L.insertBefore(i * 10);
+  }
+  L.moveFront();
+  L.moveNext();
+  ListElement out[4];
+  L.toArray(out);
+  assert(out[0] == 10 && out[1] == 20 && out[2] == 30 && out[3] == 40);
+  assert(L.position() == 1 && L.peekNext() == 20);
+  cout << "toArray() tests passed." << endl << endl;
+}
+
 void printStats(List &A) {
   cout << A << endl;
   cout << "pos: " << A.position() << '\n';
@@ -207,6 +222,7 @@ int main() {
   testFindAndCleanup();
   testConcatAndCopy();
   testToStringAndEquals();
+  testToArray();
 
   // Test movePrev by traversing backward and printing each value.
   cout << "=== Test movePrev Traversal ===" << endl;
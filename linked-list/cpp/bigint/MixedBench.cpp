@@ -0,0 +1,75 @@
+/**
+ * @author Ethan Okamura
+ * @file MixedBench.cpp
+ * @brief Counts heap allocations and time spent on a workload of mostly
+ *        one- and two-limb BigIntegers with the occasional large one
+ *        (read README.md)
+ */
+
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BigInteger.h"
+#include "CountAllocations.h"
+
+/**
+ * @brief Builds a random BigInteger with the given number of decimal digits.
+ * @param digits The number of decimal digits.
+ * @param rng The random generator to draw digits from.
+ */
+BigInteger random_integer(size_t digits, std::mt19937_64 &rng) {
+  std::string s(digits, '0');
+  for (char &c : s) c = static_cast<char>('0' + rng() % 10);
+  s[0] = static_cast<char>('1' + rng() % 9);
+  if (rng() & 1) s.insert(s.begin(), '-');
+  return BigInteger(s);
+}
+
+/**
+ * @brief Times n evaluations of (A + B) * C - A, where one evaluation in
+ *        every large_every draws its operands from the large pool.
+ * @param name The name of the workload.
+ * @param small_digits The number of digits of the usual operands.
+ * @param large_every How often to use the large pool (0 for never).
+ * @param n The number of evaluations.
+ */
+void run(const char *name, size_t small_digits, int large_every, int n) {
+  std::mt19937_64 rng(n);
+  std::vector<BigInteger> small, large;
+  for (int i = 0; i < 64; i++) {
+    small.push_back(random_integer(small_digits, rng));
+    large.push_back(random_integer(900, rng));
+  }
+
+  // checksum so the work cannot be skipped, and the results can be compared
+  size_t checksum = 0;
+  size_t before = allocationCount();
+  std::clock_t time = std::clock();  // start
+  for (int i = 0; i < n; i++) {
+    const std::vector<BigInteger> &pool =
+        large_every > 0 && i % large_every == 0 ? large : small;
+    const BigInteger &A = pool[i % 64];
+    const BigInteger &B = pool[(i * 7 + 3) % 64];
+    const BigInteger &C = pool[(i * 13 + 5) % 64];
+    BigInteger R = (A + B) * C - A;
+    checksum += R.sign() + R.chars_length();
+  }
+  time = std::clock() - time;  // stop
+  size_t count = allocationCount() - before;
+  std::cout << name << ": " << static_cast<double>(count) / n
+            << " allocations/op, "
+            << 1e9 * time / CLOCKS_PER_SEC / n << " ns/op, checksum "
+            << checksum << '\n';
+}
+
+int main(int argc, char **argv) {
+  int n = argc > 1 ? std::atoi(argv[1]) : 200000;
+  run("1 limb", 8, 0, n);
+  run("2 limbs", 17, 0, n);
+  run("mixed (1% 100 limbs)", 8, 100, n);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,119 @@
+/**
+ * @author Ethan Okamura
+ * @file MultTrials.cpp
+ * @brief Times multLimbs() against a range of algorithm cutoffs to find the
+ *        Karatsuba, Toom-3 and NTT thresholds used in Multiply.h
+ *        (read README.md)
+ */
+
+#include <ctime>
+#include <iostream>
+#include <random>
+
+#include "Multiply.h"
+
+/**
+ * @brief Builds a random operand with exactly n limbs.
+ * @param n The number of limbs.
+ * @param rng The random generator to draw limbs from.
+ */
+Limbs random_limbs(size_t n, std::mt19937_64 &rng) {
+  std::uniform_int_distribution<long> limb(0, LIMB_BASE - 1);
+  Limbs L(n);
+  for (size_t i = 0; i < n; i++) L[i] = limb(rng);
+  L[n - 1] = 1 + limb(rng) % (LIMB_BASE - 1);
+  return L;
+}
+
+/**
+ * @brief Runs one set of trials for a single cutoff field and returns the
+ *        average of the fastest constant.
+ * @param name The name of the cutoff being tuned.
+ * @param field The member of MultCutoffs being tuned.
+ * @param base The cutoffs used for every other field.
+ * @param limb_counts The operand sizes (in limbs) to time.
+ * @param const_value The candidate values of the cutoff.
+ * @param trials The amount of times to run each operand size.
+ */
+template <size_t SIZE>
+size_t run_trials(const char *name, size_t MultCutoffs::*field,
+                  const MultCutoffs &base, const size_t (&limb_counts)[SIZE],
+                  const size_t (&const_value)[SIZE], int trials) {
+  std::mt19937_64 rng(SIZE);
+  // sum of the fastest constants
+  size_t sum = 0;
+  // keep track of what trial we are on
+  int iteration = 0;
+
+  std::cout << "--- " << name << " ---\n";
+  for (int trials_left = trials; trials_left > 0; trials_left--) {
+    for (size_t i = 0; i < SIZE; i++) {
+      Limbs A = random_limbs(limb_counts[i], rng);
+      Limbs B = random_limbs(limb_counts[i], rng);
+      // keep track of how many limbs of product each cutoff produces
+      long double limbs_per_second[SIZE];
+
+      // time it against the list of const sizes
+      for (size_t j = 0; j < SIZE; j++) {
+        MultCutoffs cutoffs = base;
+        cutoffs.*field = const_value[j];
+        std::clock_t time = std::clock();  // start
+        Limbs P = multLimbs(A, B, cutoffs);
+        time = std::clock() - time;  // stop
+        limbs_per_second[j] =
+            P.size() / (static_cast<long double>(time + 1) / CLOCKS_PER_SEC);
+      }
+
+      // find fastest time
+      long double fastest_time = limbs_per_second[0];
+      size_t max_index = 0;
+      for (size_t j = 0; j < SIZE; j++) {
+        if (limbs_per_second[j] > fastest_time) {
+          fastest_time = limbs_per_second[j];
+          max_index = j;
+        }
+      }
+      // output fastest times
+      std::cout << "[trial " << iteration + 1
+                << "] const: " << const_value[max_index] << " for "
+                << limb_counts[i] << " limbs\n";
+      sum += const_value[max_index];
+      iteration++;
+    }
+  }
+  // print average (really the only output needed)
+  size_t average = sum / (SIZE * trials);
+  std::cout << "AVG: " << average << '\n';
+  return average;
+}
+
+int main() {
+  const size_t SIZE = 4;
+  // the amount of times to run each operand size
+  int trials = 5;
+
+  // Karatsuba cutoff, with Toom-3 and NTT disabled
+  const size_t never = static_cast<size_t>(-1);
+  const size_t karatsuba_limbs[SIZE] = {200, 500, 1000, 2000};
+  const size_t karatsuba_value[SIZE] = {44, 52, 60, 68};
+  MultCutoffs cutoffs = {0, never, never};
+  cutoffs.karatsuba =
+      run_trials("karatsuba", &MultCutoffs::karatsuba, cutoffs,
+                 karatsuba_limbs, karatsuba_value, trials);
+
+  // Toom-3 cutoff, on top of the Karatsuba cutoff found above
+  const size_t toom3_limbs[SIZE] = {2000, 4000, 8000, 16000};
+  const size_t toom3_value[SIZE] = {100, 150, 200, 250};
+  cutoffs.toom3 = run_trials("toom3", &MultCutoffs::toom3, cutoffs,
+                             toom3_limbs, toom3_value, trials);
+
+  // NTT cutoff, on top of both cutoffs found above
+  const size_t ntt_limbs[SIZE] = {4000, 8000, 16000, 32000};
+  const size_t ntt_value[SIZE] = {250, 500, 1000, 1500};
+  cutoffs.ntt = run_trials("ntt", &MultCutoffs::ntt, cutoffs, ntt_limbs,
+                           ntt_value, trials);
+
+  std::cout << "cutoffs: {" << cutoffs.karatsuba << ", " << cutoffs.toom3
+            << ", " << cutoffs.ntt << "}\n";
+  return 0;
+}
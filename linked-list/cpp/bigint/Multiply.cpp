@@ -0,0 +1,500 @@
+/**
+ * @author Ethan Okamura
+ * @file Multiply.cpp
+ * @brief Implementation of the limb multiplication kernels
+ * @status: working / tested
+ */
+
+#include "Multiply.h"
+#include "SimdLimbs.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+// Threads -----------------------------------------------------------------
+
+// multPool()
+// Returns the pool that parallel products run on, or nullptr while
+// multThreads() is 1.
+std::unique_ptr<ThreadPool> &multPool() {
+  static std::unique_ptr<ThreadPool> pool;
+  return pool;
+}
+
+// multThreads()
+// Returns the number of threads multLimbs() may use, counting the caller.
+size_t multThreads() { return multPool() ? multPool()->size() + 1 : 1; }
+
+// setMultThreads()
+// Makes multLimbs() use up to threads threads, counting the caller.
+// pre: threads >= 1, and no multiplication is running
+void setMultThreads(size_t threads) {
+  if (threads == 0)
+    throw std::invalid_argument("Multiply: setMultThreads(): zero threads");
+  multPool().reset(threads > 1 ? new ThreadPool(threads - 1) : nullptr);
+}
+
+// parallelFor()
+// Calls body(i) for every i in [0, count). If parallel is set and there is a
+// pool, the first count - 1 calls are queued on it while the caller runs the
+// last one and then helps with the rest. The first exception thrown is
+// rethrown once every call has finished.
+template <typename Body>
+void parallelFor(size_t count, bool parallel, Body body) {
+  ThreadPool *pool = multPool().get();
+  if (!parallel || pool == nullptr || count < 2) {
+    for (size_t i = 0; i < count; i++) body(i);
+    return;
+  }
+  std::vector<std::future<void>> pending;
+  for (size_t i = 0; i + 1 < count; i++) {
+    pending.push_back(pool->submit([&body, i] { body(i); }));
+  }
+  std::exception_ptr error;
+  try {
+    body(count - 1);
+  } catch (...) {
+    error = std::current_exception();
+  }
+  for (std::future<void> &task : pending) {
+    try {
+      pool->await(task);
+    } catch (...) {
+      if (!error) error = std::current_exception();
+    }
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+// parallelRanges()
+// Splits [0, n) into a few contiguous ranges per thread and calls
+// body(begin, end) on each through parallelFor().
+template <typename Body>
+void parallelRanges(size_t n, bool parallel, Body body) {
+  size_t ranges = parallel ? 4 * multThreads() : 1;
+  parallelFor(ranges, parallel, [&](size_t i) {
+    body(n * i / ranges, n * (i + 1) / ranges);
+  });
+}
+
+// Helpers -----------------------------------------------------------------
+
+// trimLimbs()
+// Removes leading (most significant) zero limbs from L.
+void trimLimbs(Limbs &L) {
+  while (!L.empty() && L.back() == 0) L.pop_back();
+}
+
+// sliceLimbs()
+// Returns the normalized limbs L[start, start+len), clamped to L's size.
+Limbs sliceLimbs(const Limbs &L, size_t start, size_t len) {
+  if (start >= L.size()) return Limbs();
+  size_t end = std::min(L.size(), start + len);
+  Limbs S(L.begin() + start, L.begin() + end);
+  trimLimbs(S);
+  return S;
+}
+
+// compareLimbs()
+// Returns -1, 1 or 0 according to whether A is less than, greater than or
+// equal to B.
+int compareLimbs(const Limbs &A, const Limbs &B) {
+  if (A.size() != B.size()) return A.size() < B.size() ? -1 : 1;
+  for (size_t i = A.size(); i-- > 0;) {
+    if (A[i] != B[i]) return A[i] < B[i] ? -1 : 1;
+  }
+  return 0;
+}
+
+// addLimbs()
+// Returns A + B.
+Limbs addLimbs(const Limbs &A, const Limbs &B) {
+  const Limbs &X = A.size() >= B.size() ? A : B;
+  const Limbs &Y = A.size() >= B.size() ? B : A;
+  Limbs S(X.size() + 1);
+  long carry = addLimbsN(S.data(), X.data(), Y.data(), Y.size());
+  for (size_t i = Y.size(); i < X.size(); i++) {
+    long value = X[i] + carry;
+    carry = value >= LIMB_BASE;
+    S[i] = carry ? value - LIMB_BASE : value;
+  }
+  S[X.size()] = carry;
+  trimLimbs(S);
+  return S;
+}
+
+// subLimbs()
+// Returns A - B.
+// pre: A >= B
+Limbs subLimbs(const Limbs &A, const Limbs &B) {
+  Limbs D(A.size());
+  long borrow = subLimbsN(D.data(), A.data(), B.data(), B.size());
+  for (size_t i = B.size(); i < A.size(); i++) {
+    long value = A[i] - borrow;
+    borrow = value < 0;
+    D[i] = borrow ? value + LIMB_BASE : value;
+  }
+  trimLimbs(D);
+  return D;
+}
+
+// addShiftedLimbs()
+// Adds P * LIMB_BASE^shift into R in place, propagating carries.
+// pre: R is long enough to hold the sum
+void addShiftedLimbs(Limbs &R, const Limbs &P, size_t shift) {
+  long *window = R.data() + shift;
+  long carry = addLimbsN(window, window, P.data(), P.size());
+  for (size_t i = shift + P.size(); carry; i++) {
+    long value = R[i] + carry;
+    carry = value >= LIMB_BASE;
+    R[i] = carry ? value - LIMB_BASE : value;
+  }
+}
+
+// Signed limbs used by the Toom-3 interpolation, where intermediate values
+// may be negative.
+struct SignedLimbs {
+  int sign;   // +1 (positive), -1 (negative), 0 (zero)
+  Limbs mag;  // magnitude, empty iff sign == 0
+};
+
+// toSigned()
+// Wraps the non-negative limbs L.
+SignedLimbs toSigned(const Limbs &L) { return {L.empty() ? 0 : 1, L}; }
+
+// signedAdd()
+// Returns A + B.
+SignedLimbs signedAdd(const SignedLimbs &A, const SignedLimbs &B) {
+  if (A.sign == 0) return B;
+  if (B.sign == 0) return A;
+  if (A.sign == B.sign) return {A.sign, addLimbs(A.mag, B.mag)};
+  int cmp = compareLimbs(A.mag, B.mag);
+  if (cmp == 0) return {0, Limbs()};
+  if (cmp > 0) return {A.sign, subLimbs(A.mag, B.mag)};
+  return {B.sign, subLimbs(B.mag, A.mag)};
+}
+
+// signedSub()
+// Returns A - B.
+SignedLimbs signedSub(const SignedLimbs &A, const SignedLimbs &B) {
+  return signedAdd(A, {-B.sign, B.mag});
+}
+
+// signedScale()
+// Returns A * m for a small positive m.
+SignedLimbs signedScale(const SignedLimbs &A, long m) {
+  Limbs S(A.mag.size() + 1);
+  S[A.mag.size()] = scaleLimbsN(S.data(), A.mag.data(), A.mag.size(), m);
+  trimLimbs(S);
+  return {A.sign, S};
+}
+
+// signedDivExact()
+// Returns A / d for a small positive d that is known to divide A.
+SignedLimbs signedDivExact(const SignedLimbs &A, long d) {
+  Limbs Q(A.mag.size());
+  long rem{};
+  for (size_t i = A.mag.size(); i-- > 0;) {
+    long value = rem * LIMB_BASE + A.mag[i];
+    Q[i] = value / d;
+    rem = value % d;
+  }
+  if (rem != 0)
+    throw std::logic_error("Multiply: signedDivExact(): inexact division");
+  trimLimbs(Q);
+  return {Q.empty() ? 0 : A.sign, Q};
+}
+
+// signedMult()
+// Returns A * B.
+SignedLimbs signedMult(const SignedLimbs &A, const SignedLimbs &B,
+                       const MultCutoffs &cutoffs) {
+  if (A.sign == 0 || B.sign == 0) return {0, Limbs()};
+  return {A.sign * B.sign, multLimbs(A.mag, B.mag, cutoffs)};
+}
+
+// unbalancedMult()
+// Returns A*B by cutting A into blocks of B.size() limbs and multiplying each
+// block by B. Used by multLimbs() when A is at least twice as long as B.
+Limbs unbalancedMult(const Limbs &A, const Limbs &B,
+                     const MultCutoffs &cutoffs) {
+  size_t blocks = (A.size() + B.size() - 1) / B.size();
+  std::vector<Limbs> products(blocks);
+  parallelFor(blocks, B.size() > PARALLEL_CUTOFF, [&](size_t i) {
+    products[i] = multLimbs(sliceLimbs(A, i * B.size(), B.size()), B, cutoffs);
+  });
+  Limbs R(A.size() + B.size() + 1);
+  for (size_t i = 0; i < blocks; i++) {
+    addShiftedLimbs(R, products[i], i * B.size());
+  }
+  trimLimbs(R);
+  return R;
+}
+
+// NTT primes p = c*2^k + 1, each with primitive root 3. Any convolution term
+// of two limb vectors is below NTT_MAX_LIMBS * 10^18, which is less than the
+// product of the three primes, so the CRT recovers it exactly.
+const long NTT_PRIMES[3] = {998244353, 167772161, 469762049};
+const long NTT_ROOT = 3;
+
+// powMod()
+// Returns b^e mod p.
+long powMod(long b, long e, long p) {
+  long result = 1;
+  b %= p;
+  while (e > 0) {
+    if (e & 1) result = result * b % p;
+    b = b * b % p;
+    e >>= 1;
+  }
+  return result;
+}
+
+// Transform length from which ntt() spreads each butterfly stage across
+// threads.
+const size_t NTT_PARALLEL_POINTS = size_t(1) << 14;
+
+// butterflies()
+// Runs butterflies [begin, end) of the stage that combines blocks of len
+// points, numbering the len/2 butterflies of each block consecutively.
+void butterflies(long *V, size_t len, long w_len, long p, size_t begin,
+                 size_t end) {
+  size_t half = len / 2;
+  while (begin < end) {
+    size_t j = begin % half;
+    size_t first = begin - j;  // first butterfly of this block
+    size_t last = std::min(end - first, half);
+    long *block = V + 2 * first;
+    long w = j == 0 ? 1 : powMod(w_len, j, p);
+    for (; j < last; j++) {
+      long u = block[j];
+      long v = block[j + half] * w % p;
+      block[j] = u + v < p ? u + v : u + v - p;
+      block[j + half] = u - v >= 0 ? u - v : u - v + p;
+      w = w * w_len % p;
+    }
+    begin = first + last;
+  }
+}
+
+// ntt()
+// Transforms V in place modulo p, or applies the inverse transform if
+// invert is set.
+// pre: V.size() is a power of 2 dividing p - 1
+void ntt(std::vector<long> &V, long p, bool invert) {
+  size_t n = V.size();
+  bool parallel = n >= NTT_PARALLEL_POINTS;
+  // bit-reversal permutation
+  for (size_t i = 1, j = 0; i < n; i++) {
+    size_t bit = n >> 1;
+    for (; j & bit; bit >>= 1) j ^= bit;
+    j ^= bit;
+    if (i < j) std::swap(V[i], V[j]);
+  }
+  // butterflies
+  for (size_t len = 2; len <= n; len <<= 1) {
+    long w_len = powMod(NTT_ROOT, (p - 1) / len, p);
+    if (invert) w_len = powMod(w_len, p - 2, p);
+    parallelRanges(n / 2, parallel, [&](size_t begin, size_t end) {
+      butterflies(V.data(), len, w_len, p, begin, end);
+    });
+  }
+  if (invert) {
+    long n_inv = powMod(n, p - 2, p);
+    parallelRanges(n, parallel, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; i++) V[i] = V[i] * n_inv % p;
+    });
+  }
+}
+
+// convolveMod()
+// Returns the cyclic convolution of A and B modulo p, padded to length n.
+std::vector<long> convolveMod(const Limbs &A, const Limbs &B, size_t n,
+                              long p) {
+  std::vector<long> FA(n), FB(n);
+  for (size_t i = 0; i < A.size(); i++) FA[i] = A[i] % p;
+  for (size_t i = 0; i < B.size(); i++) FB[i] = B[i] % p;
+  std::vector<long> *transforms[2] = {&FA, &FB};
+  parallelFor(2, true, [&](size_t i) { ntt(*transforms[i], p, false); });
+  parallelRanges(n, n >= NTT_PARALLEL_POINTS, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) FA[i] = FA[i] * FB[i] % p;
+  });
+  ntt(FA, p, true);
+  return FA;
+}
+
+// Multiplication kernels --------------------------------------------------
+
+// schoolbookMult()
+// Overwrites the na + nb limbs at R with A*B, where A and B are the na and
+// nb limbs starting at A and B. The top limb of R may be zero.
+// pre: R does not overlap A or B
+void schoolbookMult(const long *A, size_t na, const long *B, size_t nb,
+                    long *R) {
+  std::fill(R, R + na + nb, 0);
+  for (size_t i = 0; i < na; i++) {
+    long carry{};
+    for (size_t j = 0; j < nb; j++) {
+      // at most (10^9 - 1) + (10^9 - 1)^2 + carry, which fits in a long
+      long value = R[i + j] + A[i] * B[j] + carry;
+      carry = value / LIMB_BASE;
+      R[i + j] = value % LIMB_BASE;
+    }
+    R[i + nb] = carry;
+  }
+}
+
+// schoolbookMult()
+// Returns A*B using the O(n*m) long multiplication algorithm.
+Limbs schoolbookMult(const Limbs &A, const Limbs &B) {
+  if (A.empty() || B.empty()) return Limbs();
+  Limbs R(A.size() + B.size());
+  schoolbookMult(A.data(), A.size(), B.data(), B.size(), R.data());
+  trimLimbs(R);
+  return R;
+}
+
+// karatsubaMult()
+// Returns A*B using one level of Karatsuba splitting, recursing through
+// multLimbs() for the three half-size products.
+// pre: A.size() >= B.size() > A.size()/2
+Limbs karatsubaMult(const Limbs &A, const Limbs &B,
+                    const MultCutoffs &cutoffs) {
+  size_t half = A.size() / 2;
+  Limbs A0 = sliceLimbs(A, 0, half), A1 = sliceLimbs(A, half, A.size());
+  Limbs B0 = sliceLimbs(B, 0, half), B1 = sliceLimbs(B, half, B.size());
+
+  Limbs SA = addLimbs(A0, A1), SB = addLimbs(B0, B1);
+
+  // Z[0] = A0*B0, Z[1] = (A0 + A1)(B0 + B1), Z[2] = A1*B1
+  Limbs Z[3];
+  const Limbs *left[3] = {&A0, &SA, &A1}, *right[3] = {&B0, &SB, &B1};
+  parallelFor(3, B.size() > PARALLEL_CUTOFF, [&](size_t i) {
+    Z[i] = multLimbs(*left[i], *right[i], cutoffs);
+  });
+  Limbs &Z0 = Z[0], &Z2 = Z[2];
+  // (A0 + A1)(B0 + B1) - Z0 - Z2 = A0*B1 + A1*B0 >= 0
+  Limbs Z1 = subLimbs(subLimbs(Z[1], Z0), Z2);
+
+  Limbs R(A.size() + B.size() + 1);
+  addShiftedLimbs(R, Z0, 0);
+  addShiftedLimbs(R, Z1, half);
+  addShiftedLimbs(R, Z2, 2 * half);
+  trimLimbs(R);
+  return R;
+}
+
+// toom3Mult()
+// Returns A*B using one level of Toom-3 splitting (evaluation at 0, 1, -1,
+// -2 and infinity), recursing through multLimbs() for the five third-size
+// products. Interpolation follows Bodrato's sequence.
+// pre: A.size() >= B.size() > A.size()/2
+Limbs toom3Mult(const Limbs &A, const Limbs &B, const MultCutoffs &cutoffs) {
+  size_t k = (A.size() + 2) / 3;
+  SignedLimbs A0 = toSigned(sliceLimbs(A, 0, k));
+  SignedLimbs A1 = toSigned(sliceLimbs(A, k, k));
+  SignedLimbs A2 = toSigned(sliceLimbs(A, 2 * k, k));
+  SignedLimbs B0 = toSigned(sliceLimbs(B, 0, k));
+  SignedLimbs B1 = toSigned(sliceLimbs(B, k, k));
+  SignedLimbs B2 = toSigned(sliceLimbs(B, 2 * k, k));
+
+  // evaluate both polynomials at 1, -1 and -2
+  SignedLimbs P = signedAdd(A0, A2);
+  SignedLimbs Pp1 = signedAdd(P, A1);
+  SignedLimbs Pm1 = signedSub(P, A1);
+  SignedLimbs Pm2 = signedSub(signedScale(signedAdd(Pm1, A2), 2), A0);
+  SignedLimbs Q = signedAdd(B0, B2);
+  SignedLimbs Qp1 = signedAdd(Q, B1);
+  SignedLimbs Qm1 = signedSub(Q, B1);
+  SignedLimbs Qm2 = signedSub(signedScale(signedAdd(Qm1, B2), 2), B0);
+
+  // pointwise products
+  SignedLimbs R0, R1, Rm1, Rm2, R4;
+  SignedLimbs *products[5] = {&R0, &R1, &Rm1, &Rm2, &R4};
+  const SignedLimbs *left[5] = {&A0, &Pp1, &Pm1, &Pm2, &A2};
+  const SignedLimbs *right[5] = {&B0, &Qp1, &Qm1, &Qm2, &B2};
+  parallelFor(5, B.size() > PARALLEL_CUTOFF, [&](size_t i) {
+    *products[i] = signedMult(*left[i], *right[i], cutoffs);
+  });
+
+  // interpolate
+  SignedLimbs R3 = signedDivExact(signedSub(Rm2, R1), 3);
+  R1 = signedDivExact(signedSub(R1, Rm1), 2);
+  SignedLimbs R2 = signedSub(Rm1, R0);
+  R3 = signedAdd(signedDivExact(signedSub(R2, R3), 2), signedScale(R4, 2));
+  R2 = signedSub(signedAdd(R2, R1), R4);
+  R1 = signedSub(R1, R3);
+
+  // recompose; every coefficient of a product of non-negative polynomials
+  // is itself non-negative
+  Limbs R(A.size() + B.size() + 1);
+  const SignedLimbs *coefficients[] = {&R0, &R1, &R2, &R3, &R4};
+  for (size_t i = 0; i < 5; i++) {
+    if (coefficients[i]->sign < 0)
+      throw std::logic_error("Multiply: toom3Mult(): negative coefficient");
+    addShiftedLimbs(R, coefficients[i]->mag, i * k);
+  }
+  trimLimbs(R);
+  return R;
+}
+
+// nttMult()
+// Returns A*B exactly by convolving the limbs with a number-theoretic
+// transform modulo three primes and recombining with the CRT.
+// pre: A.size() + B.size() <= NTT_MAX_LIMBS
+Limbs nttMult(const Limbs &A, const Limbs &B) {
+  if (A.empty() || B.empty()) return Limbs();
+  if (A.size() + B.size() > NTT_MAX_LIMBS)
+    throw std::length_error("Multiply: nttMult(): product too long");
+  size_t n = 1;
+  while (n < A.size() + B.size()) n <<= 1;
+
+  const long p0 = NTT_PRIMES[0], p1 = NTT_PRIMES[1], p2 = NTT_PRIMES[2];
+  std::vector<long> residues[3];
+  parallelFor(3, true, [&](size_t k) {
+    residues[k] = convolveMod(A, B, n, NTT_PRIMES[k]);
+  });
+  std::vector<long> &R0 = residues[0], &R1 = residues[1], &R2 = residues[2];
+
+  // Garner's algorithm: x = r0 + p0*t1 + p0*p1*t2. The digits are found
+  // independently per term (overwriting R0 with x01 and R1 with t2), then
+  // the carries are resolved in order.
+  const long p0_inv = powMod(p0, p1 - 2, p1);
+  const long p01_inv = powMod(p0 % p2 * p1 % p2, p2 - 2, p2);
+  Limbs R(A.size() + B.size());
+  parallelRanges(R.size(), n >= NTT_PARALLEL_POINTS,
+                 [&](size_t begin, size_t end) {
+                   for (size_t i = begin; i < end; i++) {
+                     long t1 = (R1[i] - R0[i] % p1 + p1) % p1 * p0_inv % p1;
+                     long x01 = R0[i] + p0 * t1;  // < p0*p1, fits in a long
+                     R1[i] = (R2[i] - x01 % p2 + p2) % p2 * p01_inv % p2;
+                     R0[i] = x01;
+                   }
+                 });
+  unsigned __int128 carry{};
+  for (size_t i = 0; i < R.size(); i++) {
+    unsigned __int128 value =
+        static_cast<unsigned __int128>(p0 * p1) * R1[i] + R0[i] + carry;
+    R[i] = static_cast<long>(value % LIMB_BASE);
+    carry = value / LIMB_BASE;
+  }
+  trimLimbs(R);
+  return R;
+}
+
+// multLimbs()
+// Returns A*B, choosing schoolbook, Karatsuba, Toom-3 or NTT by operand size.
+// Unbalanced operands are split into blocks the size of the shorter one.
+Limbs multLimbs(const Limbs &A, const Limbs &B, const MultCutoffs &cutoffs) {
+  const Limbs &X = A.size() >= B.size() ? A : B;
+  const Limbs &Y = A.size() >= B.size() ? B : A;
+  if (Y.empty()) return Limbs();
+  if (Y.size() <= cutoffs.karatsuba) return schoolbookMult(X, Y);
+  if (Y.size() > cutoffs.ntt && X.size() + Y.size() <= NTT_MAX_LIMBS)
+    return nttMult(X, Y);
+  if (2 * Y.size() <= X.size()) return unbalancedMult(X, Y, cutoffs);
+  if (Y.size() <= cutoffs.toom3) return karatsubaMult(X, Y, cutoffs);
+  return toom3Mult(X, Y, cutoffs);
+}
@@ -0,0 +1,123 @@
+/**
+ * @author Ethan Okamura
+ * @file Multiply.h
+ * @brief Header file for the limb multiplication kernels used by BigInteger
+ * @status: working / tested
+ */
+
+#include <cstddef>
+#include <vector>
+
+#ifndef MULTIPLY_H_INCLUDE_
+#define MULTIPLY_H_INCLUDE_
+
+// Exported types -------------------------------------------------------------
+
+// Little-endian (least significant first) base 10^9 limbs, normalized so that
+// every limb is in [0, LIMB_BASE) and there are no leading zero limbs. Zero
+// is the empty vector.
+typedef std::vector<long> Limbs;
+
+const long LIMB_BASE = 1000000000;
+
+// Operand sizes (in limbs) at which multLimbs() switches algorithms. An
+// operand pair is handed to the first algorithm whose cutoff is not exceeded
+// by the shorter operand.
+struct MultCutoffs {
+  size_t karatsuba;  // above this: Karatsuba instead of schoolbook
+  size_t toom3;      // above this: Toom-3 instead of Karatsuba
+  size_t ntt;        // above this: NTT instead of Toom-3
+};
+
+// Cutoffs found with MultTrials (read README.md)
+const MultCutoffs DEFAULT_CUTOFFS = {58, 185, 612};
+
+// Longest product (in limbs) the three NTT primes can represent exactly.
+// Longer products are split by Toom-3 until the pieces fit.
+const size_t NTT_MAX_LIMBS = size_t(1) << 23;
+
+// Shorter-operand size (in limbs) above which Karatsuba, Toom-3 and unbalanced
+// products hand their sub-products to other threads, when setMultThreads()
+// allows more than one. NTT products are always split.
+const size_t PARALLEL_CUTOFF = 256;
+
+// Threads --------------------------------------------------------------------
+
+// multThreads()
+// Returns the number of threads multLimbs() may use, counting the caller.
+size_t multThreads();
+
+// setMultThreads()
+// Makes multLimbs() use up to threads threads, counting the caller. 1 (the
+// default) keeps every product on the calling thread.
+// pre: threads >= 1, and no multiplication is running
+void setMultThreads(size_t threads);
+
+// Limb helpers ---------------------------------------------------------------
+
+// trimLimbs()
+// Removes leading (most significant) zero limbs from L.
+void trimLimbs(Limbs &L);
+
+// sliceLimbs()
+// Returns the normalized limbs L[start, start+len), clamped to L's size.
+Limbs sliceLimbs(const Limbs &L, size_t start, size_t len);
+
+// compareLimbs()
+// Returns -1, 1 or 0 according to whether A is less than, greater than or
+// equal to B.
+int compareLimbs(const Limbs &A, const Limbs &B);
+
+// addLimbs()
+// Returns A + B.
+Limbs addLimbs(const Limbs &A, const Limbs &B);
+
+// subLimbs()
+// Returns A - B.
+// pre: A >= B
+Limbs subLimbs(const Limbs &A, const Limbs &B);
+
+// addShiftedLimbs()
+// Adds P * LIMB_BASE^shift into R in place, propagating carries.
+// pre: R is long enough to hold the sum
+void addShiftedLimbs(Limbs &R, const Limbs &P, size_t shift);
+
+// Multiplication kernels -----------------------------------------------------
+
+// schoolbookMult()
+// Overwrites the na + nb limbs at R with A*B, where A and B are the na and
+// nb limbs starting at A and B. The top limb of R may be zero.
+// pre: R does not overlap A or B
+void schoolbookMult(const long *A, size_t na, const long *B, size_t nb,
+                    long *R);
+
+// schoolbookMult()
+// Returns A*B using the O(n*m) long multiplication algorithm.
+Limbs schoolbookMult(const Limbs &A, const Limbs &B);
+
+// karatsubaMult()
+// Returns A*B using one level of Karatsuba splitting, recursing through
+// multLimbs() for the three half-size products.
+// pre: A.size() >= B.size() > A.size()/2
+Limbs karatsubaMult(const Limbs &A, const Limbs &B, const MultCutoffs &cutoffs);
+
+// toom3Mult()
+// Returns A*B using one level of Toom-3 splitting (evaluation at 0, 1, -1,
+// -2 and infinity), recursing through multLimbs() for the five third-size
+// products.
+// pre: A.size() >= B.size() > A.size()/2
+Limbs toom3Mult(const Limbs &A, const Limbs &B, const MultCutoffs &cutoffs);
+
+// nttMult()
+// Returns A*B exactly by convolving the limbs with a number-theoretic
+// transform modulo three primes and recombining with the CRT.
+// pre: A.size() + B.size() <= NTT_MAX_LIMBS
+Limbs nttMult(const Limbs &A, const Limbs &B);
+
+// multLimbs()
+// Returns A*B, choosing schoolbook, Karatsuba, Toom-3 or NTT by operand size.
+// Unbalanced operands are split into blocks the size of the shorter one.
+Limbs multLimbs(const Limbs &A, const Limbs &B,
+                const MultCutoffs &cutoffs = DEFAULT_CUTOFFS);
+
+#endif
@@ -0,0 +1,84 @@
+/**
+ * @author Ethan Okamura
+ * @file ParallelBench.cpp
+ * @brief Times multLimbs() on an NTT-sized and a Toom-3-sized product with
+ *        1 thread up to every core (read README.md)
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <thread>
+
+#include "Multiply.h"
+
+/**
+ * @brief Returns n random limbs with a nonzero top limb.
+ */
+Limbs random_limbs(size_t n, std::mt19937_64 &rng) {
+  std::uniform_int_distribution<long> limb(0, LIMB_BASE - 1);
+  Limbs L(n);
+  for (long &x : L) x = limb(rng);
+  L.back() = std::max(L.back(), 1L);
+  return L;
+}
+
+/**
+ * @brief Returns the best wall-clock milliseconds of three products. Wall
+ *        time rather than std::clock(), which sums the CPU time of every
+ *        thread.
+ */
+double time_mult(const Limbs &A, const Limbs &B, const MultCutoffs &cutoffs,
+                 Limbs &product) {
+  double best = 0;
+  for (int run = 0; run < 3; run++) {
+    auto start = std::chrono::steady_clock::now();
+    product = multLimbs(A, B, cutoffs);
+    std::chrono::duration<double, std::milli> time =
+        std::chrono::steady_clock::now() - start;
+    if (run == 0 || time.count() < best) best = time.count();
+  }
+  return best;
+}
+
+int main(int argc, char **argv) {
+  size_t digits = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+  size_t cores = std::max(1u, std::thread::hardware_concurrency());
+  size_t max_threads =
+      argc > 2 ? std::strtoul(argv[2], nullptr, 10) : cores;
+  size_t n = std::max<size_t>(1, digits / 9);
+
+  std::mt19937_64 rng(digits);
+  // NTT: the default cutoffs; Toom-3: a tenth of the size with the NTT off
+  Limbs A = random_limbs(n, rng), B = random_limbs(n, rng);
+  Limbs C = random_limbs(n / 10 + 1, rng), D = random_limbs(n / 10 + 1, rng);
+  const MultCutoffs toom_only = {DEFAULT_CUTOFFS.karatsuba,
+                                 DEFAULT_CUTOFFS.toom3, SIZE_MAX};
+
+  std::cout << "--- " << digits << " digits, " << cores << " cores ---\n";
+  double ntt_base = 0, toom_base = 0;
+  Limbs ntt_expected, toom_expected;
+  for (size_t threads = 1; threads <= max_threads; threads++) {
+    setMultThreads(threads);
+    Limbs ntt_product, toom_product;
+    double ntt_ms = time_mult(A, B, DEFAULT_CUTOFFS, ntt_product);
+    double toom_ms = time_mult(C, D, toom_only, toom_product);
+    if (threads == 1) {
+      ntt_base = ntt_ms;
+      toom_base = toom_ms;
+      ntt_expected = ntt_product;
+      toom_expected = toom_product;
+    } else if (ntt_product != ntt_expected || toom_product != toom_expected) {
+      std::cerr << "ParallelBench: " << threads
+                << " threads differ from 1 thread\n";
+      return EXIT_FAILURE;
+    }
+    std::cout << threads << " threads: ntt " << ntt_ms << " ms ("
+              << ntt_base / ntt_ms << "x), toom3 " << toom_ms << " ms ("
+              << toom_base / toom_ms << "x)\n";
+  }
+  return EXIT_SUCCESS;
+}
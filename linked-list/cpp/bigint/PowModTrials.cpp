@@ -0,0 +1,172 @@
+/**
+ * @author Ethan Okamura
+ * @file PowModTrials.cpp
+ * @brief Times divmodLimbs() and reduceLimbs() against a range of cutoffs
+ *        to find the NEWTON_CUTOFF and BARRETT_CUTOFF used in Divide.h, then
+ *        times 4096-bit modular exponentiation with Knuth and Barrett
+ *        reduction (read README.md)
+ */
+
+#include <ctime>
+#include <iostream>
+#include <random>
+
+#include "Divide.h"
+
+/**
+ * @brief Builds a random operand with exactly n limbs.
+ * @param n The number of limbs.
+ * @param rng The random generator to draw limbs from.
+ */
+Limbs random_limbs(size_t n, std::mt19937_64 &rng) {
+  std::uniform_int_distribution<long> limb(0, LIMB_BASE - 1);
+  Limbs L(n);
+  for (size_t i = 0; i < n; i++) L[i] = limb(rng);
+  L[n - 1] = 1 + limb(rng) % (LIMB_BASE - 1);
+  return L;
+}
+
+/**
+ * @brief Builds a random operand with exactly the given number of bits.
+ * @param bits The number of bits (a multiple of 32).
+ * @param rng The random generator to draw bits from.
+ */
+Limbs random_bits(size_t bits, std::mt19937_64 &rng) {
+  // 2^32 in base 10^9
+  const Limbs word_base = {294967296, 4};
+  Limbs L;
+  for (size_t i = 0; i < bits / 32; i++) {
+    long word = static_cast<long>(rng() & 0xFFFFFFFF);
+    if (i == 0) word |= 1L << 31;
+    L = multLimbs(L, word_base);
+    Limbs W = {word % LIMB_BASE, word / LIMB_BASE};
+    trimLimbs(W);
+    L = addLimbs(L, W);
+  }
+  return L;
+}
+
+/**
+ * @brief Times one division of A by B with the given Newton cutoff.
+ * @return The number of quotient limbs produced per second.
+ */
+long double time_divmod(const Limbs &A, const Limbs &B, size_t cutoff) {
+  Limbs Q, R;
+  std::clock_t time = std::clock();  // start
+  divmodLimbs(A, B, Q, R, cutoff);
+  time = std::clock() - time;  // stop
+  return Q.size() / (static_cast<long double>(time + 1) / CLOCKS_PER_SEC);
+}
+
+/**
+ * @brief Times ten reductions of A modulo B with the given Barrett cutoff.
+ *        The reciprocal is computed outside the timed region, as it is once
+ *        per powmod().
+ * @return The number of reduced limbs produced per second.
+ */
+long double time_reduce(const Limbs &A, const Limbs &B, size_t cutoff) {
+  ModReducer reducer = makeReducer(B, cutoff);
+  Limbs R;
+  std::clock_t time = std::clock();  // start
+  for (int i = 0; i < 10; i++) R = reduceLimbs(A, reducer);
+  time = std::clock() - time;  // stop
+  return 10 * B.size() /
+         (static_cast<long double>(time + 1) / CLOCKS_PER_SEC);
+}
+
+/**
+ * @brief Runs one set of trials for a single cutoff and returns the average
+ *        of the fastest constant. Each trial divides a random number of 2n
+ *        limbs by a random number of n limbs.
+ * @param name The name of the cutoff being tuned.
+ * @param timer The operation to time.
+ * @param limb_counts The divisor sizes (in limbs) to time.
+ * @param const_value The candidate values of the cutoff.
+ * @param trials The amount of times to run each divisor size.
+ */
+template <size_t SIZE>
+size_t run_trials(const char *name,
+                  long double (*timer)(const Limbs &, const Limbs &, size_t),
+                  const size_t (&limb_counts)[SIZE],
+                  const size_t (&const_value)[SIZE], int trials) {
+  std::mt19937_64 rng(SIZE);
+  // sum of the fastest constants
+  size_t sum = 0;
+  // keep track of what trial we are on
+  int iteration = 0;
+
+  std::cout << "--- " << name << " ---\n";
+  for (int trials_left = trials; trials_left > 0; trials_left--) {
+    for (size_t i = 0; i < SIZE; i++) {
+      Limbs A = random_limbs(2 * limb_counts[i], rng);
+      Limbs B = random_limbs(limb_counts[i], rng);
+      // time it against the list of const sizes
+      long double limbs_per_second[SIZE];
+      for (size_t j = 0; j < SIZE; j++) {
+        limbs_per_second[j] = timer(A, B, const_value[j]);
+      }
+
+      // find fastest time
+      long double fastest_time = limbs_per_second[0];
+      size_t max_index = 0;
+      for (size_t j = 0; j < SIZE; j++) {
+        if (limbs_per_second[j] > fastest_time) {
+          fastest_time = limbs_per_second[j];
+          max_index = j;
+        }
+      }
+      // output fastest times
+      std::cout << "[trial " << iteration + 1
+                << "] const: " << const_value[max_index] << " for "
+                << limb_counts[i] << " limbs\n";
+      sum += const_value[max_index];
+      iteration++;
+    }
+  }
+  // print average (really the only output needed)
+  size_t average = sum / (SIZE * trials);
+  std::cout << "AVG: " << average << '\n';
+  return average;
+}
+
+int main() {
+  const size_t SIZE = 4;
+  // the amount of times to run each divisor size
+  int trials = 5;
+
+  // Newton cutoff for a single division
+  const size_t newton_limbs[SIZE] = {800, 1600, 3200, 4800};
+  const size_t newton_value[SIZE] = {1000, 1500, 2000, 3000};
+  run_trials("newton", time_divmod, newton_limbs, newton_value, trials);
+
+  // Barrett cutoff for repeated reduction by the same modulus
+  const size_t barrett_limbs[SIZE] = {200, 400, 800, 1600};
+  const size_t barrett_value[SIZE] = {100, 200, 400, 800};
+  run_trials("barrett", time_reduce, barrett_limbs, barrett_value, trials);
+
+  // 4096-bit modular exponentiation, Knuth reduction vs Barrett reduction
+  std::mt19937_64 rng(4096);
+  const int runs = 5;
+  Limbs B = random_bits(4096, rng);
+  Limbs E = random_bits(4096, rng);
+  Limbs M = random_bits(4096, rng);
+  M[0] |= 1;
+  std::cout << "--- powmod 4096-bit (" << M.size() << " limbs) ---\n";
+  const char *names[2] = {"knuth", "barrett"};
+  const size_t cutoffs[2] = {static_cast<size_t>(-1), 0};
+  Limbs results[2];
+  for (int j = 0; j < 2; j++) {
+    std::clock_t time = std::clock();  // start
+    for (int run = 0; run < runs; run++) {
+      results[j] = powmodLimbs(B, E, M, cutoffs[j]);
+    }
+    time = std::clock() - time;  // stop
+    std::cout << names[j] << ": "
+              << 1000.0 * time / CLOCKS_PER_SEC / runs << " ms/powmod\n";
+  }
+  if (results[0] != results[1]) {
+    std::cerr << "PowModTrials: knuth and barrett results differ\n";
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,86 @@
+/**
+ * @author Ethan Okamura
+ * @file SerializeBench.cpp
+ * @brief Times loading a large BigInteger from decimal text, from the binary
+ *        format with read(), and through a mapped BigIntegerView (read
+ *        README.md)
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include "BigInteger.h"
+#include "BigIntegerView.h"
+
+/**
+ * @brief Returns the seconds taken by one call of load.
+ */
+template <typename Load>
+double time_load(Load load) {
+  std::clock_t time = std::clock();  // start
+  load();
+  time = std::clock() - time;  // stop
+  return static_cast<double>(time) / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char **argv) {
+  size_t digits = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000000;
+  const std::string text_path = "SerializeBench.txt";
+  const std::string binary_path = "SerializeBench.bin";
+
+  std::mt19937_64 rng(digits);
+  std::string s(digits, '0');
+  for (char &c : s) c = static_cast<char>('0' + rng() % 10);
+  s[0] = '1';
+  BigInteger N(s);
+  {
+    std::ofstream text(text_path);
+    text << s;
+    std::ofstream binary(binary_path, std::ios::binary);
+    N.write(binary);
+  }
+  s.clear();
+
+  BigInteger M;
+  double parse = time_load([&] {
+    std::ifstream text(text_path);
+    std::stringstream buffer;
+    buffer << text.rdbuf();
+    M = BigInteger(buffer.str());
+  });
+  bool ok = M == N;
+  double read = time_load([&] {
+    std::ifstream binary(binary_path, std::ios::binary);
+    M.read(binary);
+  });
+  ok = ok && M == N;
+  double map = time_load([&] {
+    BigIntegerView view(binary_path);
+    ok = ok && view.sign() == 1;
+  });
+  double copy = time_load([&] {
+    BigIntegerView view(binary_path);
+    M = view.value();
+  });
+  ok = ok && M == N;
+  std::remove(text_path.c_str());
+  std::remove(binary_path.c_str());
+  if (!ok) {
+    std::cerr << "SerializeBench: loaded value differs\n";
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "--- " << digits << " digits ---\n";
+  std::cout << "decimal parse: " << parse << " s\n";
+  std::cout << "binary read(): " << read << " s (" << parse / read
+            << "x)\n";
+  std::cout << "view open: " << map << " s\n";
+  std::cout << "view value(): " << copy << " s (" << parse / copy << "x)\n";
+  return EXIT_SUCCESS;
+}
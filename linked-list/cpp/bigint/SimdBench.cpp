@@ -0,0 +1,75 @@
+/**
+ * @author Ethan Okamura
+ * @file SimdBench.cpp
+ * @brief Times the limb add, subtract and scale kernels at every SimdLevel
+ *        this CPU supports on 10^6-limb operands (read README.md)
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <random>
+
+#include "Multiply.h"
+#include "SimdLimbs.h"
+
+/**
+ * @brief Times runs calls of one kernel and returns nanoseconds per limb.
+ * @param kernel Calls the kernel once.
+ * @param n The number of limbs per call.
+ * @param runs The number of calls.
+ */
+template <typename Kernel>
+double time_kernel(Kernel kernel, size_t n, int runs) {
+  std::clock_t time = std::clock();  // start
+  for (int run = 0; run < runs; run++) kernel();
+  time = std::clock() - time;  // stop
+  return 1e9 * time / CLOCKS_PER_SEC / (static_cast<double>(n) * runs);
+}
+
+int main(int argc, char **argv) {
+  size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+  // at least 2 * 10^7 limbs per kernel, so small sizes are timeable
+  const int runs = std::max<int>(20, 20000000 / std::max<size_t>(n, 1));
+  std::mt19937_64 rng(n);
+  std::uniform_int_distribution<long> limb(0, LIMB_BASE - 1);
+  Limbs A(n), B(n), R(n), expected[3];
+  for (size_t i = 0; i < n; i++) {
+    A[i] = limb(rng);
+    B[i] = limb(rng);
+  }
+  const long m = limb(rng);
+
+  const char *names[3] = {"add", "sub", "scale"};
+  double scalar[3] = {};
+  std::cout << "--- " << n << " limbs, " << runs << " runs ---\n";
+  for (int level = 0; level <= static_cast<int>(detectSimdLevel()); level++) {
+    setSimdLevel(static_cast<SimdLevel>(level));
+    double ns[3];
+    ns[0] = time_kernel([&] { addLimbsN(R.data(), A.data(), B.data(), n); },
+                        n, runs);
+    Limbs results[3];
+    results[0] = R;
+    ns[1] = time_kernel([&] { subLimbsN(R.data(), A.data(), B.data(), n); },
+                        n, runs);
+    results[1] = R;
+    ns[2] = time_kernel([&] { scaleLimbsN(R.data(), A.data(), n, m); }, n,
+                        runs);
+    results[2] = R;
+
+    for (int k = 0; k < 3; k++) {
+      if (level == 0) {
+        scalar[k] = ns[k];
+        expected[k] = results[k];
+      } else if (results[k] != expected[k]) {
+        std::cerr << "SimdBench: " << names[k] << " differs from scalar\n";
+        return EXIT_FAILURE;
+      }
+      std::cout << simdLevelName(static_cast<SimdLevel>(level)) << ' '
+                << names[k] << ": " << ns[k] << " ns/limb ("
+                << scalar[k] / ns[k] << "x scalar)\n";
+    }
+  }
+  return EXIT_SUCCESS;
+}
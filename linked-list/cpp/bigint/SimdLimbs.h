@@ -0,0 +1,53 @@
+/**
+ * @author Ethan Okamura
+ * @file SimdLimbs.h
+ * @brief Header file for the vectorized limb add, subtract and scale
+ *        kernels, which pick AVX2, SSE4.2 or scalar code at runtime
+ * @status: working / tested
+ */
+
+#include <cstddef>
+
+#include "../simd/FindKernels.h"
+
+#ifndef SIMD_LIMBS_H_INCLUDE_
+#define SIMD_LIMBS_H_INCLUDE_
+
+// SimdLevel and detectSimdLevel() come from FindKernels.h, which the
+// unrolled list in ../linked-list-2 uses for its search kernels.
+
+// simdLevel()
+// Returns the SimdLevel the kernels currently use. This is
+// detectSimdLevel() unless changed with setSimdLevel().
+SimdLevel simdLevel();
+
+// setSimdLevel()
+// Makes the kernels use the given SimdLevel.
+// pre: level <= detectSimdLevel()
+void setSimdLevel(SimdLevel level);
+
+// simdLevelName()
+// Returns "scalar", "sse4" or "avx2".
+const char *simdLevelName(SimdLevel level);
+
+// Kernels --------------------------------------------------------------------
+// Operands are n base 10^9 limbs, least significant first. R may be the same
+// array as A or B.
+
+// addLimbsN()
+// Overwrites R[0, n) with A[0, n) + B[0, n), and returns the carry out of
+// the top limb (0 or 1).
+long addLimbsN(long *R, const long *A, const long *B, size_t n);
+
+// subLimbsN()
+// Overwrites R[0, n) with A[0, n) - B[0, n), and returns the borrow out of
+// the top limb (0 or 1).
+long subLimbsN(long *R, const long *A, const long *B, size_t n);
+
+// scaleLimbsN()
+// Overwrites R[0, n) with A[0, n) * m, and returns the limb carried out of
+// the top (less than m).
+// pre: 0 <= m < 10^9
+long scaleLimbsN(long *R, const long *A, size_t n, long m);
+
+#endif
@@ -0,0 +1,64 @@
+/**
+ * @author Ethan Okamura
+ * @file ThreadPool.cpp
+ * @brief Implementation of the fixed-size thread pool
+ * @status: working / tested
+ */
+
+#include "ThreadPool.h"
+
+// Class Constructors & Destructors ----------------------------------------
+
+// ThreadPool()
+// Creates a pool of the given number of worker threads.
+ThreadPool::ThreadPool(size_t threads) : stopping(false) {
+  for (size_t i = 0; i < threads; i++) {
+    workers.emplace_back([this] { workerLoop(); });
+  }
+}
+
+// Destructor
+// Finishes the queued tasks, then joins the workers.
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    stopping = true;
+  }
+  ready.notify_all();
+  for (std::thread &worker : workers) worker.join();
+}
+
+// Helpers -----------------------------------------------------------------
+
+// workerLoop()
+// Runs queued tasks until the pool is destroyed.
+void ThreadPool::workerLoop() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> guard(lock);
+      ready.wait(guard, [this] { return stopping || !tasks.empty(); });
+      if (tasks.empty()) return;
+      task = std::move(tasks.front());
+      tasks.pop_front();
+    }
+    task();
+  }
+}
+
+// Manipulation procedures -------------------------------------------------
+
+// runPending()
+// Runs one queued task on the calling thread. Returns false if the queue was
+// empty.
+bool ThreadPool::runPending() {
+  std::function<void()> task;
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    if (tasks.empty()) return false;
+    task = std::move(tasks.front());
+    tasks.pop_front();
+  }
+  task();
+  return true;
+}
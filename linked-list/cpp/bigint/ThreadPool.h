@@ -0,0 +1,92 @@
+/**
+ * @author Ethan Okamura
+ * @file ThreadPool.h
+ * @brief Header file for the fixed-size thread pool that runs the parallel
+ *        parts of multLimbs()
+ * @status: working / tested
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifndef THREAD_POOL_H_INCLUDE_
+#define THREAD_POOL_H_INCLUDE_
+
+// Exported type  -------------------------------------------------------------
+class ThreadPool {
+ private:
+  // ThreadPool Fields
+  std::vector<std::thread> workers;         // threads running workerLoop()
+  std::deque<std::function<void()>> tasks;  // queued tasks, oldest first
+  std::mutex lock;                          // guards tasks and stopping
+  std::condition_variable ready;            // signalled on new tasks
+  bool stopping;                            // set by the destructor
+
+  // workerLoop()
+  // Runs queued tasks until the pool is destroyed.
+  void workerLoop();
+
+ public:
+  // Class Constructors & Destructors ----------------------------------------
+
+  // ThreadPool()
+  // Creates a pool of the given number of worker threads.
+  explicit ThreadPool(size_t threads);
+
+  // Destructor
+  // Finishes the queued tasks, then joins the workers.
+  ~ThreadPool();
+
+  // Access functions --------------------------------------------------------
+
+  // size()
+  // Returns the number of worker threads.
+  size_t size() const { return workers.size(); }
+
+  // Manipulation procedures -------------------------------------------------
+
+  // submit()
+  // Queues task and returns a future for its result. Exceptions thrown by
+  // the task are rethrown by the future.
+  template <typename Task>
+  std::future<decltype(std::declval<Task>()())> submit(Task task) {
+    using Result = decltype(task());
+    auto packaged =
+        std::make_shared<std::packaged_task<Result()>>(std::move(task));
+    std::future<Result> result = packaged->get_future();
+    {
+      std::lock_guard<std::mutex> guard(lock);
+      tasks.emplace_back([packaged] { (*packaged)(); });
+    }
+    ready.notify_one();
+    return result;
+  }
+
+  // runPending()
+  // Runs one queued task on the calling thread. Returns false if the queue
+  // was empty.
+  bool runPending();
+
+  // await()
+  // Returns the result of a submitted task, running queued tasks on the
+  // calling thread while it waits. Tasks may therefore submit and await
+  // tasks of their own without the pool running out of threads.
+  template <typename Result>
+  Result await(std::future<Result> &result) {
+    while (result.wait_for(std::chrono::seconds(0)) !=
+           std::future_status::ready) {
+      if (!runPending()) std::this_thread::yield();
+    }
+    return result.get();
+  }
+};
+
+#endif
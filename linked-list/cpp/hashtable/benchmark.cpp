@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "chained_hashtable.h"
+#include "hashtable.h"
+
+// times a search for every key of a chained table holding n records in
+// chains of about chain records each, and returns nanoseconds per search
+double time_chain_search(int n, int chain) {
+  ChainedHashTable table(n / chain);
+  for (int key = 0; key < n; key++) table.insert(Record(key, "value"));
+  std::clock_t time = std::clock();  // start
+  for (int key = 0; key < n; key++) {
+    Record *p = table.search(key);
+    if (p == nullptr || p->first() != key) {
+      std::cerr << "benchmark: key " << key << " not found\n";
+      std::exit(EXIT_FAILURE);
+    }
+  }
+  time = std::clock() - time;  // stop
+  return 1e9 * time / CLOCKS_PER_SEC / n;
+}
+
+// returns nanoseconds per call since start, for n calls
+double ns_since(std::clock_t start, int n) {
+  return 1e9 * (std::clock() - start) / CLOCKS_PER_SEC / n;
+}
+
+// fills a table of slots slots (or buckets) with keys, then times an
+// insert of each key, a search for each key, a search for each of misses,
+// and a delete of each key; prints one row in ns per operation
+template <typename Table>
+void time_table(const char *name, int slots, const std::vector<int> &keys,
+                const std::vector<int> &misses) {
+  int n = keys.size();
+  Table table(slots);
+  std::clock_t start = std::clock();
+  for (int key : keys) table.insert(Record(key, "value"));
+  double insert = ns_since(start, n);
+
+  start = std::clock();
+  for (int key : keys) {
+    Record *p = table.search(key);
+    if (p == nullptr || p->first() != key) {
+      std::cerr << "benchmark: key " << key << " not found\n";
+      std::exit(EXIT_FAILURE);
+    }
+  }
+  double hit = ns_since(start, n);
+
+  start = std::clock();
+  for (int key : misses) {
+    if (table.search(key) != nullptr) {
+      std::cerr << "benchmark: key " << key << " found\n";
+      std::exit(EXIT_FAILURE);
+    }
+  }
+  double miss = ns_since(start, n);
+
+  start = std::clock();
+  for (int key : keys) table.delete_element(key);
+  double remove = ns_since(start, n);
+  if (!table.is_empty()) {
+    std::cerr << "benchmark: table not empty\n";
+    std::exit(EXIT_FAILURE);
+  }
+
+  std::cout << std::left << std::setw(10) << name << std::right << std::fixed
+            << std::setprecision(1) << std::setw(10) << insert
+            << std::setw(10) << hit << std::setw(10) << miss << std::setw(10)
+            << remove << '\n';
+}
+
+// usage: benchmark [slots] [longest chain]
+int main(int argc, char **argv) {
+  int slots = argc > 1 ? std::atoi(argv[1]) : 1 << 17;
+  int longest = argc > 2 ? std::atoi(argv[2]) : 1000;
+  std::cout << "--- chained table: search every key of " << slots
+            << " records ---\n";
+  for (int chain = 1; chain <= longest; chain *= 10) {
+    std::cout << "chain length " << chain << ": "
+              << time_chain_search(slots, chain) << " ns/search\n";
+  }
+
+  // distinct random keys; the first half are stored, the rest miss
+  // below 2^30, as the chained table's hash overflows on larger keys and
+  // goes negative on negative ones
+  std::mt19937 gen(42);
+  std::vector<int> pool(2 * slots);
+  for (int &key : pool) key = gen() & 0x3FFFFFFF;
+  std::sort(pool.begin(), pool.end());
+  pool.erase(std::unique(pool.begin(), pool.end()), pool.end());
+  std::shuffle(pool.begin(), pool.end(), gen);
+
+  std::cout << "--- " << slots << " slots (chained: buckets), ns/operation ---\n"
+            << "table         insert       hit      miss    delete\n";
+  for (int percent = 50; percent <= 90; percent += 10) {
+    int n = static_cast<long>(slots) * percent / 100;
+    std::vector<int> keys(pool.begin(), pool.begin() + n);
+    std::vector<int> misses(pool.begin() + n, pool.begin() + 2 * n);
+    std::cout << "load factor 0." << percent / 10 << '\n';
+    time_table<ChainedHashTable>("chained", slots, keys, misses);
+    time_table<HashTable>("swiss", slots, keys, misses);
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,66 @@
+#include "chained_hashtable.h"
+
+// default constructor
+ChainedHashTable::ChainedHashTable(int size) : m(size) {
+  table = new LinkedList<Record>[size];
+  for (int i = 0; i < size; i++) {
+    table[i] = LinkedList<Record>{};
+  }
+}
+
+// destructor
+ChainedHashTable::~ChainedHashTable() { delete[] table; }
+
+// insert a key value pair
+void ChainedHashTable::insert(Record record) {
+  int index = hash(record.first());
+  table[index].push_front(record);
+}
+
+// delete a key value pair
+void ChainedHashTable::delete_element(int key) {
+  int index = hash(key);
+  if (table[index].empty()) return;
+  Record* element = search(key);
+  if (element == nullptr) return;
+  table[index].remove(*element);
+}
+
+// find a key value pair
+Record* ChainedHashTable::search(int key) { return find(key); }
+
+// private search
+// walks the bucket once with its iterators
+Record* ChainedHashTable::find(int key) {
+  for (Record& record : table[hash(key)])
+    if (record.first() == key) return &record;
+  return nullptr;
+}
+
+// check to see if table is empty
+bool ChainedHashTable::is_empty() const {
+  for (int i = 0; i < m; ++i)
+    if (!table[i].empty()) return false;
+  return true;
+}
+
+// clear the table
+void ChainedHashTable::clear() {
+  if (m == 0) return;
+  for (int i = 0; i < m; i++)
+    if (!table[i].empty()) table[i].clear();
+}
+
+// print out the pairs in the list (one per line)
+void ChainedHashTable::print_values(std::ofstream& out) {
+  for (int i = 0; i < m; i++)
+    if (!table[i].empty()) out << table[i];
+}
+
+// hash a pair's key
+int ChainedHashTable::hash(Record record) { return hash(record.first()); }
+
+// hash a key with mutliplicaiton method
+int ChainedHashTable::hash(int key) {
+  return static_cast<int>(m * (key * c - static_cast<int>(key * c)));
+}
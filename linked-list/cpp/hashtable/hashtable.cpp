@@ -1,69 +1,334 @@
 #include "hashtable.h"
 
-// default constructor
-HashTable::HashTable(int size) : m(size) {
-  table = new LinkedList<Record>[size];
-  for (int i = 0; i < size; i++) {
-    table[i] = LinkedList<Record>{};
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <new>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef __unix__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// record arrays of at least MAP_BYTES get a mapping of their own, whose
+// moved-out pages are unmapped UNMAP_BYTES or more at a time
+static constexpr std::size_t MAP_BYTES = 1 << 20;
+static constexpr std::size_t UNMAP_BYTES = 1 << 18;
+
+// the 16 control bytes of one group, matched all at once
+// bit i of each mask is set when slot i of the group matches
+class Group {
+ public:
+  explicit Group(const std::int8_t *control) {
+#ifdef __SSE2__
+    bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(control));
+#else
+    std::memcpy(bytes, control, sizeof(bytes));
+#endif
+  }
+  // slots whose control byte is h2
+  std::uint32_t match(std::int8_t h2) const {
+#ifdef __SSE2__
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(h2)));
+#else
+    std::uint32_t mask = 0;
+    for (int i = 0; i < 16; i++) mask |= std::uint32_t(bytes[i] == h2) << i;
+    return mask;
+#endif
+  }
+  // EMPTY slots
+  std::uint32_t match_empty() const { return match(0); }
+  // EMPTY or DELETED slots: the only control bytes without the top bit set
+  std::uint32_t match_free() const {
+#ifdef __SSE2__
+    return ~_mm_movemask_epi8(bytes) & 0xFFFF;
+#else
+    std::uint32_t mask = 0;
+    for (int i = 0; i < 16; i++) mask |= std::uint32_t(bytes[i] >= 0) << i;
+    return mask;
+#endif
   }
+
+ private:
+#ifdef __SSE2__
+  __m128i bytes;
+#else
+  std::int8_t bytes[16];
+#endif
+};
+
+// default constructor
+HashTable::HashTable(int size, bool incremental)
+    : next_old(0), count(0), incremental(incremental) {
+  int groups = 1;
+  while (groups * GROUP_SIZE < size) groups *= 2;
+  allocate(table, groups);
+  growth_left = max_load();
 }
 
 // destructor
-HashTable::~HashTable() {}
+HashTable::~HashTable() {
+  release(table);
+  release(old);
+}
 
 // insert a key value pair
 void HashTable::insert(Record record) {
-  int index = hash(record.first());
-  table[index].push_front(record);
+  migrate(MIGRATE_GROUPS);
+  std::uint64_t h = hash(record.first());
+  int free;
+  int slot = find(table, record.first(), h, free);
+  if (slot >= 0) {
+    table.records[slot] = std::move(record);
+    return;
+  }
+  if (old.groups > 0) {
+    int old_free;
+    slot = find(old, record.first(), h, old_free);
+    if (slot >= 0) {
+      old.records[slot] = std::move(record);
+      return;
+    }
+  }
+  if (table.control[free] == EMPTY && growth_left == 0) {
+    // the EMPTY slots left are reserved to end probes: move to a larger
+    // table, or to one of the same size without tombstones
+    migrate(old.groups);  // only if growing outran the last move
+    start_rehash(2 * count <= max_load() ? table.groups : 2 * table.groups);
+    if (!incremental) migrate(old.groups);
+    find(table, record.first(), h, free);
+  }
+  // a slot is only marked full once it holds a Record
+  new (&table.records[free]) Record(std::move(record));
+  if (table.control[free] == EMPTY) growth_left--;
+  table.control[free] = full(h);
+  count++;
 }
 
 // delete a key value pair
 void HashTable::delete_element(int key) {
-  int index = hash(key);
-  if (table[index].empty()) return;
-  Record* element = search(key);
-  if (element == nullptr) return;
-  table[index].remove(*element);
+  migrate(MIGRATE_GROUPS);
+  std::uint64_t h = hash(key);
+  int free;
+  int slot = find(table, key, h, free);
+  if (slot >= 0) {
+    // a probe only passes a group that had no EMPTY slot, so if this group
+    // has one, no probe passes it and the slot can be EMPTY again
+    int group = slot / GROUP_SIZE;
+    if (Group(table.control + group * GROUP_SIZE).match_empty()) {
+      table.control[slot] = EMPTY;
+      growth_left++;
+    } else {
+      table.control[slot] = DELETED;
+    }
+    table.records[slot].~Record();
+    count--;
+  } else if (old.groups > 0 && (slot = find(old, key, h, free)) >= 0) {
+    // old only shrinks, so a tombstone there costs nothing later
+    old.control[slot] = DELETED;
+    old.records[slot].~Record();
+    count--;
+  }
 }
 
 // find a key value pair
-Record* HashTable::search(int key) { return find(key); }
+Record *HashTable::search(int key) {
+  std::uint64_t h = hash(key);
+  int free;
+  int slot = find(table, key, h, free);
+  if (slot >= 0) return &table.records[slot];
+  if (old.groups > 0 && (slot = find(old, key, h, free)) >= 0)
+    return &old.records[slot];
+  return nullptr;
+}
 
 // private search
-Record* HashTable::find(int key) {
-  int index = hash(key);
-  if (table[index].empty()) return nullptr;
-  for (std::size_t i = 0; i < table[index].size(); i++) {
-    Record* p = &table[index][i];
-    if ((*p).first() == key) return p;
+// probes groups h1, h1 + 1, h1 + 3, h1 + 6, ... which visits every group
+// once when their number is a power of two
+int HashTable::find(const Slots &slots, int key, std::uint64_t hash,
+                    int &free) {
+  std::int8_t h2 = full(hash);
+  int mask = slots.groups - 1;
+  int group = static_cast<int>(hash >> 25) & mask;
+  free = -1;
+  for (int probe = 1; probe <= slots.groups; probe++) {
+    Group g(slots.control + group * GROUP_SIZE);
+    for (std::uint32_t bits = g.match(h2); bits; bits &= bits - 1) {
+      int slot = group * GROUP_SIZE + __builtin_ctz(bits);
+      if (slots.records[slot].first() == key) return slot;
+    }
+    if (free < 0)
+      if (std::uint32_t bits = g.match_free())
+        free = group * GROUP_SIZE + __builtin_ctz(bits);
+    if (g.match_empty()) return -1;
+    group = (group + probe) & mask;
   }
-  return nullptr;
+  return -1;
 }
 
-// check to see if table is empty
-bool HashTable::is_empty() const {
-  for (int i = 0; i < m; ++i)
-    if (!table[i].empty()) return false;
-  return true;
+// allocate groups groups of EMPTY slots
+// EMPTY is 0 and the records are raw storage, so a large table comes as
+// fresh zeroed pages from calloc (or mmap) and costs nothing until it is used
+// slots is only changed once both arrays are allocated
+void HashTable::allocate(Slots &slots, int groups) {
+  int capacity = groups * GROUP_SIZE;
+  std::size_t bytes = capacity * sizeof(Record);
+  std::int8_t *control = static_cast<std::int8_t *>(std::calloc(capacity, 1));
+  if (control == nullptr) throw std::bad_alloc();
+  Record *records = nullptr;
+  bool mapped = false;
+#ifdef __unix__
+  if (bytes >= MAP_BYTES) {
+    void *pages = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (pages == MAP_FAILED) {
+      std::free(control);
+      throw std::bad_alloc();
+    }
+    records = static_cast<Record *>(pages);
+    mapped = true;
+  }
+#endif
+  if (!mapped) {
+    try {
+      records = static_cast<Record *>(::operator new(bytes));
+    } catch (...) {
+      std::free(control);
+      throw;
+    }
+  }
+  slots.control = control;
+  slots.records = records;
+  slots.groups = groups;
+  slots.mapped = mapped;
+  slots.unmapped = 0;
 }
 
+// destroy the records in slots and free them
+void HashTable::release(Slots &slots) {
+  for (int i = 0; i < slots.capacity(); i++)
+    if (slots.control[i] < 0) slots.records[i].~Record();
+  deallocate(slots);
+}
+
+// free slots, whose records have been destroyed or moved out
+void HashTable::deallocate(Slots &slots) {
+  std::free(slots.control);
+#ifdef __unix__
+  if (slots.mapped) {
+    std::size_t bytes = slots.capacity() * sizeof(Record);
+    if (slots.unmapped < bytes)
+      munmap(reinterpret_cast<char *>(slots.records) + slots.unmapped,
+             bytes - slots.unmapped);
+    slots = Slots();
+    return;
+  }
+#endif
+  ::operator delete(slots.records);
+  slots = Slots();
+}
+
+// unmap the whole pages of records that only hold the first groups groups,
+// once there are UNMAP_BYTES of them, so the pages go back to the system a
+// few at a time during the move rather than all at once at its end
+// lookups never read the records of a moved group, which are all DELETED
+void HashTable::unmap_moved(Slots &slots, int groups) {
+#ifdef __unix__
+  if (!slots.mapped) return;
+  static const std::size_t page = sysconf(_SC_PAGESIZE);
+  std::size_t end = groups * GROUP_SIZE * sizeof(Record) / page * page;
+  if (end - slots.unmapped < UNMAP_BYTES) return;
+  munmap(reinterpret_cast<char *>(slots.records) + slots.unmapped,
+         end - slots.unmapped);
+  slots.unmapped = end;
+#else
+  (void)slots, (void)groups;
+#endif
+}
+
+// start moving the records to a new table of groups groups
+// pre: no move is in progress
+void HashTable::start_rehash(int groups) {
+  Slots fresh;
+  allocate(fresh, groups);  // if this throws, the table is unchanged
+  old = table;
+  table = fresh;
+  next_old = 0;
+  growth_left = max_load();
+}
+
+// move the records of up to groups old groups into table, and free old
+// once every group has been moved
+void HashTable::migrate(int groups) {
+  if (old.groups == 0) return;
+  int stop = next_old + groups < old.groups ? next_old + groups : old.groups;
+  for (; next_old < stop; next_old++) {
+    for (int i = next_old * GROUP_SIZE; i < (next_old + 1) * GROUP_SIZE; i++) {
+      if (old.control[i] >= 0) continue;
+      std::uint64_t h = hash(old.records[i].first());
+      int free;
+      find(table, old.records[i].first(), h, free);
+      new (&table.records[free]) Record(std::move(old.records[i]));
+      if (table.control[free] == EMPTY) growth_left--;
+      table.control[free] = full(h);
+      old.records[i].~Record();
+      old.control[i] = DELETED;
+    }
+  }
+  if (next_old == old.groups)
+    deallocate(old);  // every record moved out
+  else
+    unmap_moved(old, next_old);
+}
+
+// check to see if table is empty
+bool HashTable::is_empty() const { return count == 0; }
+
 // clear the table
 void HashTable::clear() {
-  if (m == 0) return;
-  for (int i = 0; i < m; i++)
-    if (!table[i].empty()) table[i].clear();
+  release(old);
+  for (int i = 0; i < table.capacity(); i++)
+    if (table.control[i] < 0) table.records[i].~Record();
+  std::memset(table.control, EMPTY, table.capacity());
+  count = 0;
+  growth_left = max_load();
+}
+
+// print out the pairs in the table (one per line)
+void HashTable::print_values(std::ofstream &out) {
+  for (const Slots *slots : {&table, &old}) {
+    for (int i = 0; i < slots->capacity(); i++) {
+      if (slots->control[i] >= 0) continue;
+      Record &record = slots->records[i];
+      out << std::setfill('0') << std::setw(9) << record.first() << ' ';
+      out << record.second() << '\n';
+    }
+  }
 }
 
-// print out the pairs in the list (one per line)
-void HashTable::print_values(std::ofstream& out) {
-  for (int i = 0; i < m; i++)
-    if (!table[i].empty()) out << table[i];
+int HashTable::size() const { return count; }
+
+int HashTable::capacity() const { return table.capacity(); }
+
+bool HashTable::is_rehashing() const { return old.groups > 0; }
+
+// a table holds at most 15/16 of its slots, so probes stay short
+int HashTable::max_load() const {
+  return table.capacity() - table.capacity() / 16;
 }
 
-// hash a pair's key
-int HashTable::hash(Record record) { return hash(record.first()); }
+// control byte of a full slot whose key hashes to hash
+std::int8_t HashTable::full(std::uint64_t hash) {
+  return static_cast<std::int8_t>(0x80 | hash >> 57);
+}
 
-// hash a key with mutliplicaiton method
-int HashTable::hash(int key) {
-  return static_cast<int>(m * (key * c - static_cast<int>(key * c)));
+// hash a key with the multiplication method, in integers: the key times
+// 2^64 over phi. The top 7 bits of the product are h2; the 32 bits below
+// them (bits 25 to 56) pick the group
+std::uint64_t HashTable::hash(int key) const {
+  return static_cast<std::uint32_t>(key) * 0x9E3779B97F4A7C15ull;
 }
@@ -1,32 +1,82 @@
 #ifndef HASHTABLE_H
 #define HASHTABLE_H
 
-#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <fstream>
 #include <string>
 
-#include "linked_list.h"
+#include "record.h"
 
+// Defines an open-addressing hash table in the style of a Swiss table.
+// Slots come in groups of 16, and each slot has a control byte: EMPTY,
+// DELETED (a tombstone), or the top bit and 7 bits of its key's hash (h2)
+// when full.
+// A lookup hashes the key to a group and compares h2 against all 16 control
+// bytes of the group at once (one SSE2 compare), so only slots whose h2
+// matches are read. It probes the next group (quadratically, by groups)
+// until it meets a group with an EMPTY slot.
+//
+// When an insert would fill the table past 15/16, it moves to a new array
+// of slots, twice as large (or the same size, when most of the used slots
+// are tombstones). The records are not all moved at once: the old array is
+// kept, and each insert and delete moves MIGRATE_GROUPS of its groups to the
+// new one. Until it is empty, lookups that miss the new array also probe the
+// old one. A large record array is a mapping of its own, and the pages the
+// move has passed are unmapped as it goes, so no insert frees it all at once.
 class HashTable {
  public:
-  HashTable(int size = 100);  // build a table
-  ~HashTable();               // destroy a table
-  void insert(Record);        // insert copy of record
-  void delete_element(int);   // delete a record
-  // return pointer to a copy of found record, or null
+  // build a table of at least size slots; it grows as records are added
+  // incremental = false moves every record at once when the table grows
+  HashTable(int size = 100, bool incremental = true);
+  ~HashTable();  // destroy a table
+  HashTable(const HashTable &) = delete;
+  HashTable &operator=(const HashTable &) = delete;
+  void insert(Record);       // insert copy of record, replacing its key's
+  void delete_element(int);  // delete a record
+  // return pointer to the found record, or null
   Record *search(int);
   void print_values(
       std::ofstream &);   // prints out a list of keys (one per line)
   bool is_empty() const;  // checks if the table is empty
-  void clear();           // clears the list
+  void clear();           // clears the table
+  int size() const;       // number of records
+  int capacity() const;   // number of slots records are inserted into
+  bool is_rehashing() const;  // checks if records are still being moved
  private:
-  Record *find(int);  // keeps privacy
-  int hash(Record);   // hash value for record
-  int hash(int);      // hash value for key
-  const int m;        // size of table
-  // vector of linked lists that hold key value pairs
-  LinkedList<Record> *table;
-  const double c = 1 / ((std::sqrt(5) - 1) / 2.0);  // one over phi
+  static constexpr int GROUP_SIZE = 16;
+  static constexpr int MIGRATE_GROUPS = 2;  // old groups moved per operation
+  static constexpr std::int8_t EMPTY = 0;    // 0b00000000
+  static constexpr std::int8_t DELETED = 1;  // 0b00000001
+  // an array of slots and their control bytes
+  struct Slots {
+    std::int8_t *control = nullptr;  // control byte of each slot
+    Record *records = nullptr;  // raw storage; only full slots hold a Record
+    int groups = 0;             // number of groups, a power of two
+    bool mapped = false;        // records is a mapping of its own
+    std::size_t unmapped = 0;   // bytes at the front of records unmapped
+    int capacity() const { return groups * GROUP_SIZE; }
+  };
+  // slot of key in slots, or -1; sets free to the first slot on key's probe
+  // sequence that could take it, or -1
+  static int find(const Slots &slots, int key, std::uint64_t hash,
+                  int &free);
+  static void allocate(Slots &, int groups);  // empty slots
+  static void release(Slots &);  // destroys the records, frees the slots
+  static void deallocate(Slots &);  // frees the slots
+  // unmaps the pages of records that only hold the first groups groups
+  static void unmap_moved(Slots &, int groups);
+  static std::int8_t full(std::uint64_t hash);  // control byte for hash
+  std::uint64_t hash(int) const;  // hash value for key
+  void start_rehash(int groups);  // moves to a new array of groups groups
+  void migrate(int groups);       // moves up to groups old groups over
+  int max_load() const;           // records the table may hold
+  Slots table;                    // where records are inserted
+  Slots old;                      // being moved into table, or none
+  int next_old;                   // first old group not moved yet
+  int count;                      // number of records, in table and old
+  int growth_left;  // EMPTY slots of table that may still be filled
+  bool incremental;
 };
 
 #endif  // HASHTABLE_H
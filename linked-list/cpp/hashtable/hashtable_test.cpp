@@ -0,0 +1,116 @@
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "hashtable.h"
+
+// a value long enough to live on the heap, so a record that is moved or
+// destroyed twice shows up under a sanitizer
+std::string value(int step) {
+  return "value written at step " + std::to_string(step);
+}
+
+// checks that table prints exactly the records of expected, in any order
+void check_print(HashTable &table,
+                 const std::unordered_map<int, std::string> &expected) {
+  const char *name = "hashtable_test.txt";
+  {
+    std::ofstream out(name);
+    table.print_values(out);
+  }
+  std::vector<std::string> printed, lines;
+  std::ifstream in(name);
+  for (std::string line; std::getline(in, line);) printed.push_back(line);
+  for (const auto &kv : expected) {
+    std::ostringstream line;
+    line << std::setfill('0') << std::setw(9) << kv.first << ' ' << kv.second;
+    lines.push_back(line.str());
+  }
+  std::sort(printed.begin(), printed.end());
+  std::sort(lines.begin(), lines.end());
+  assert(printed == lines);
+}
+
+// runs steps random operations on a table that starts at 16 slots and on an
+// unordered_map, with keys drawn from range keys around 0, and checks that
+// they agree after each one
+void run(bool incremental, int range, int steps) {
+  std::cout << (incremental ? "incremental" : "all at once") << ", " << range
+            << " keys: ";
+  HashTable table(16, incremental);
+  std::unordered_map<int, std::string> expected;
+  std::mt19937 gen(range);
+  int growths = 0, prints = 0, clears = 0;
+  int capacity = table.capacity();
+  long during = 0;  // operations run while records were being moved
+  for (int step = 0; step < steps; step++) {
+    bool rehashing = table.is_rehashing();
+    assert(incremental || !rehashing);
+    during += rehashing;
+    int key = static_cast<int>(gen() % range) - range / 2;
+    int op = gen() % 8;
+    if (op < 4) {  // insert, or overwrite when the key is there
+      table.insert(Record(key, value(step)));
+      expected[key] = value(step);
+    } else if (op < 6) {
+      table.delete_element(key);
+      expected.erase(key);
+    } else {
+      Record *found = table.search(key);
+      auto it = expected.find(key);
+      assert((found == nullptr) == (it == expected.end()));
+      if (found) assert(found->first() == key && found->second() == it->second);
+    }
+    assert(table.size() == static_cast<int>(expected.size()));
+    assert(table.is_empty() == expected.empty());
+
+    bool grew = table.capacity() != capacity;
+    if (grew) {
+      growths++;
+      capacity = table.capacity();
+    }
+    // print once in each move, and clear in the move after every 4th growth
+    // (with incremental = false, right after the growth)
+    if (rehashing && prints < growths) {
+      check_print(table, expected);
+      prints++;
+    }
+    if ((incremental ? rehashing : grew) && growths % 4 == 0 &&
+        clears < growths / 4) {
+      table.clear();
+      expected.clear();
+      assert(table.is_empty() && !table.is_rehashing());
+      clears++;
+    }
+  }
+  for (const auto &kv : expected) {
+    Record *found = table.search(kv.first);
+    assert(found && found->second() == kv.second);
+  }
+  check_print(table, expected);
+  assert(growths > 0 && clears > 0);
+  if (incremental) assert(during > 0 && prints > 0);
+  std::cout << growths << " growths, " << during
+            << " operations while moving, " << prints << " prints, "
+            << clears << " clears, passed\n";
+}
+
+int main() {
+  for (bool incremental : {true, false}) {
+    run(incremental, 4000, 500000);      // grows, then churns tombstones
+    run(incremental, 200000, 2000000);   // the same, in a large table
+    run(incremental, 1 << 30, 1500000);  // keeps growing
+  }
+  std::remove("hashtable_test.txt");
+  std::cout << "All tests passed.\n";
+  return EXIT_SUCCESS;
+}
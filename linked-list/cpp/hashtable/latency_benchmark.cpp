@@ -0,0 +1,102 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "hashtable.h"
+
+using Clock = std::chrono::steady_clock;
+
+// returns the p-th percentile of sorted values
+double percentile(const std::vector<double> &sorted, double p) {
+  if (sorted.empty()) return 0;
+  return sorted[static_cast<std::size_t>(p / 100 * (sorted.size() - 1))];
+}
+
+// prints one row: percentiles of the latencies, in us
+void report(const char *name, std::vector<double> latencies) {
+  std::sort(latencies.begin(), latencies.end());
+  double total = 0;
+  for (double latency : latencies) total += latency;
+  std::cout << std::left << std::setw(22) << name << std::right
+            << std::setw(9) << latencies.size() << std::fixed
+            << std::setprecision(2) << std::setw(9)
+            << percentile(latencies, 50) << std::setw(9)
+            << percentile(latencies, 99) << std::setw(9)
+            << percentile(latencies, 99.9) << std::setw(11)
+            << (latencies.empty() ? 0 : latencies.back()) << std::setw(10)
+            << total / 1000 << '\n';
+}
+
+// inserts every key into table, timing each insert
+// growing(table) tells if the table is growing; an insert made while it
+// is, or that starts it, counts as during growth; one that was made while
+// it was and leaves it done counts as ending a move
+template <typename Table, typename Insert, typename Growing>
+void run(const char *name, Table &table, const std::vector<int> &keys,
+         Insert insert, Growing growing) {
+  std::vector<double> all, during, ending;
+  all.reserve(keys.size());
+  for (int key : keys) {
+    bool before = growing(table);
+    Clock::time_point start = Clock::now();
+    insert(table, key);
+    std::chrono::duration<double, std::micro> took = Clock::now() - start;
+    all.push_back(took.count());
+    bool after = growing(table);
+    if (before || after) during.push_back(took.count());
+    if (before && !after) ending.push_back(took.count());
+  }
+  report(name, all);
+  report("  during growth", during);
+  if (!ending.empty()) report("  ending a move", ending);
+}
+
+// usage: latency_benchmark [records]
+int main(int argc, char **argv) {
+  int n = argc > 1 ? std::atoi(argv[1]) : 2000000;
+  std::mt19937 gen(42);
+  std::vector<int> keys(n);
+  for (int &key : keys) key = gen();
+
+  std::cout << "--- insert " << n << " random keys into a table of 16 slots"
+            << " ---\n"
+            << "table                   inserts   p50 us   p99 us p99.9 us"
+               "     max us  total ms\n";
+  {
+    HashTable table(16);
+    run("incremental rehash", table, keys,
+        [](HashTable &t, int key) { t.insert(Record(key, "value")); },
+        [](HashTable &t) { return t.is_rehashing(); });
+  }
+  {
+    HashTable table(16, false);
+    int capacity = table.capacity();
+    run("rehash all at once", table, keys,
+        [](HashTable &t, int key) { t.insert(Record(key, "value")); },
+        [&capacity](HashTable &t) {
+          bool grew = t.capacity() != capacity;
+          capacity = t.capacity();
+          return grew;
+        });
+  }
+  {
+    std::unordered_map<int, std::string> table(16);
+    std::size_t buckets = table.bucket_count();
+    run("std::unordered_map", table, keys,
+        [](std::unordered_map<int, std::string> &t, int key) {
+          t[key] = "value";
+        },
+        [&buckets](std::unordered_map<int, std::string> &t) {
+          bool grew = t.bucket_count() != buckets;
+          buckets = t.bucket_count();
+          return grew;
+        });
+  }
+  return EXIT_SUCCESS;
+}
@@ -1,9 +1,11 @@
 #ifndef LINKED_LIST_H
 #define LINKED_LIST_H
 
+#include <cstddef>
 #include <initializer_list>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
 
 #include "record.h"
 
@@ -12,6 +14,50 @@ template <typename Record>
 class LinkedList {
   struct Node;  // forward declaration for our private Node type
  public:
+  // forward iterator over the elements, from head to one past the tail
+  // Value is Record for iterator and const Record for const_iterator
+  template <typename Value>
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Record;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value *;
+    using reference = Value &;
+
+    Iterator() : node(nullptr) {}
+    // an iterator converts to a const_iterator
+    operator Iterator<const Record>() const { return Iterator<const Record>(node); }
+
+    reference operator*() const { return node->data; }
+    pointer operator->() const { return &node->data; }
+
+    Iterator &operator++() {
+      node = node->next;
+      return *this;
+    }
+    Iterator operator++(int) {
+      Iterator old = *this;
+      node = node->next;
+      return old;
+    }
+
+    friend bool operator==(const Iterator &a, const Iterator &b) {
+      return a.node == b.node;
+    }
+    friend bool operator!=(const Iterator &a, const Iterator &b) {
+      return a.node != b.node;
+    }
+
+   private:
+    friend class LinkedList;
+    friend class Iterator<Record>;
+    explicit Iterator(Node *node) : node(node) {}
+    Node *node;
+  };
+  using iterator = Iterator<Record>;
+  using const_iterator = Iterator<const Record>;
+
   // default constructor
   LinkedList() : head(nullptr), tail(nullptr), list_size(0) {}
 
@@ -36,11 +82,13 @@ class LinkedList {
     }
   }
 
-  // return head for iteration
-  Node *begin() const { return head; }
-
-  // return tail for iteration
-  Node *end() const { return tail; }
+  // iterators to the head and to one past the tail
+  iterator begin() { return iterator(head); }
+  iterator end() { return iterator(nullptr); }
+  const_iterator begin() const { return const_iterator(head); }
+  const_iterator end() const { return const_iterator(nullptr); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
 
   // returns the value of the head node
   Record &front() const {
@@ -244,8 +292,7 @@ class LinkedList {
 
   // allows stdout of list
   friend std::ostream &operator<<(std::ostream &out, const LinkedList &list) {
-    for (size_t i = 0; i < list.size(); i++) {
-      Record p = list[i];
+    for (Record p : list) {
       out << std::setfill('0') << std::setw(9) << p.first() << ' ';
       out << p.second() << '\n';
     }
@@ -1,8 +1,12 @@
 #include "record.h"
 
+#include <utility>
+
 Record::Record() : key(0), value("") {}
 Record::Record(int key, std::string value) : key(key), value(value) {}
 Record::Record(const Record& other) : key(other.key), value(other.value) {}
+Record::Record(Record&& other) noexcept
+    : key(other.key), value(std::move(other.value)) {}
 int Record::first() { return key; }
 std::string Record::second() { return value; }
 Record& Record::operator=(const Record& other) {
@@ -12,6 +16,11 @@ Record& Record::operator=(const Record& other) {
   }
   return *this;
 }
+Record& Record::operator=(Record&& other) noexcept {
+  key = other.key;
+  value = std::move(other.value);
+  return *this;
+}
 bool Record::operator==(Record other) {
   return other.key == key && other.value == value;
 }
@@ -1,3 +1,6 @@
+#ifndef RECORD_H
+#define RECORD_H
+
 #include <string>
 
 class Record {
@@ -5,13 +8,17 @@ class Record {
   Record();
   Record(int key, std::string value);
   Record(const Record& other);
+  Record(Record&& other) noexcept;
   int first();
   std::string second();
   Record& operator=(const Record& other);
+  Record& operator=(Record&& other) noexcept;
   bool operator==(Record other);
   bool operator!=(Record other);
 
  private:
   int key;
   std::string value;
-};
\ No newline at end of file
+};
+
+#endif  // RECORD_H
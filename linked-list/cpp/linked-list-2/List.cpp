@@ -7,14 +7,121 @@
 
 #include "List.h"
 
+#include <algorithm>
+#include <new>
 #include <unordered_map>
 
+// Nodes in the first and largest pool blocks.
+const size_t MIN_POOL_BLOCK = 16;
+const size_t MAX_POOL_BLOCK = 4096;
+
 List::Node::Node(ListElement x) : data(x), next(nullptr), prev(nullptr) {}
 
+List::Arena::~Arena() {
+  for (Node* B : blocks) ::operator delete(B);
+}
+
+// Helpers -----------------------------------------------------------------
+
+// newNode()
+// Returns a node holding x, taken from the spare list. Allocates a new
+// block, twice the size of the last one, when the spare list is empty.
+List::Node* List::newNode(ListElement x) {
+  if (spare == nullptr) {
+    if (!arena) arena = std::make_shared<Arena>();
+    std::vector<Node*>& blocks = arena->blocks;
+    size_t n = std::min(MIN_POOL_BLOCK << std::min<size_t>(blocks.size(), 8),
+                        MAX_POOL_BLOCK);
+    Node* B = static_cast<Node*>(::operator new(n * sizeof(Node)));
+    blocks.push_back(B);
+    for (size_t i = 0; i < n; i++) {
+      B[i].next = spare;
+      spare = &B[i];
+    }
+    spare_last = B;
+  }
+  Node* N = spare;
+  spare = spare->next;
+  return new (N) Node(x);
+}
+
+// freeNode()
+// Returns N to the spare list.
+void List::freeNode(Node* N) {
+  if (spare == nullptr) spare_last = N;
+  N->next = spare;
+  spare = N;
+}
+
+// swapState()
+// Exchanges the nodes, cursor and pool of this List with those of L.
+void List::swapState(List& L) noexcept {
+  std::swap(frontDummy->next, L.frontDummy->next);
+  std::swap(backDummy->prev, L.backDummy->prev);
+  std::swap(afterCursor, L.afterCursor);
+  std::swap(beforeCursor, L.beforeCursor);
+  std::swap(pos_cursor, L.pos_cursor);
+  std::swap(num_elements, L.num_elements);
+  std::swap(spare, L.spare);
+  std::swap(spare_last, L.spare_last);
+  std::swap(arena, L.arena);
+  others.swap(L.others);
+  std::swap(others_unique, L.others_unique);
+  relinkDummies(L);
+  L.relinkDummies(*this);
+}
+
+// relinkDummies()
+// Called by swapState(): points the links and cursor of this List that
+// still refer to the dummies of L at its own.
+void List::relinkDummies(const List& L) noexcept {
+  if (frontDummy->next == L.backDummy) frontDummy->next = backDummy;
+  if (backDummy->prev == L.frontDummy) backDummy->prev = frontDummy;
+  frontDummy->next->prev = frontDummy;
+  backDummy->prev->next = backDummy;
+  if (beforeCursor == L.frontDummy) beforeCursor = frontDummy;
+  if (afterCursor == L.backDummy) afterCursor = backDummy;
+}
+
+// shareArenas()
+// Makes this List hold every Arena that L holds.
+void List::shareArenas(const List& L) {
+  if (L.arena && L.arena != arena) others.push_back(L.arena);
+  others.insert(others.end(), L.others.begin(), L.others.end());
+  if (others.size() > 2 * others_unique + 8) {
+    std::sort(others.begin(), others.end());
+    others.erase(std::unique(others.begin(), others.end()), others.end());
+    auto self = std::lower_bound(others.begin(), others.end(), arena);
+    if (self != others.end() && *self == arena) others.erase(self);
+    others_unique = others.size();
+  }
+}
+
+// linkBeforeCursor()
+// Links the n nodes first..last in before the cursor, leaving the cursor
+// after them.
+void List::linkBeforeCursor(Node* first, Node* last, int n) {
+  first->prev = beforeCursor;
+  beforeCursor->next = first;
+  last->next = afterCursor;
+  afterCursor->prev = last;
+  beforeCursor = last;
+  pos_cursor += n;
+  num_elements += n;
+}
+
+// Class Constructors & Destructors ----------------------------------------
+
 // Creates new List in the empty state.
-List::List() : pos_cursor(0), num_elements(0) {
-  frontDummy = new Node(-1);
-  backDummy = new Node(-1);
+List::List()
+    : dummies{Node(-1), Node(-1)},
+      frontDummy(&dummies[0]),
+      backDummy(&dummies[1]),
+      pos_cursor(0),
+      num_elements(0),
+      spare(nullptr),
+      spare_last(nullptr),
+      others_unique(0) {
   frontDummy->next = backDummy;
   backDummy->prev = frontDummy;
   beforeCursor = frontDummy;
@@ -30,15 +137,11 @@ List::List(const List& L) : List() {
   }
 }
 
-// Destructor
-List::~List() {
-  Node* current = frontDummy;
-  while (current != nullptr) {
-    Node* next = current->next;
-    delete current;
-    current = next;
-  }
-}
+// Move constructor. L is left empty. Allocates nothing.
+List::List(List&& L) noexcept : List() { swapState(L); }
+
+// Destructor. The Arenas free the nodes.
+List::~List() {}
 
 // Access functions --------------------------------------------------------
 
@@ -87,20 +190,20 @@ ListElement List::peekPrev() const {
 // Manipulation procedures -------------------------------------------------
 
 // clear()
-// Deletes all elements in this List, setting it to the empty state.
+// Deletes all elements in this List, setting it to the empty state, and
+// releases its node pool. Every node this List held is then unused, so the
+// blocks of each Arena no other List holds are freed.
 void List::clear() {
-  Node* current = frontDummy->next;
-  while (current != backDummy) {
-    Node* next = current->next;
-    delete current;
-    current = next;
-  }
   frontDummy->next = backDummy;
   backDummy->prev = frontDummy;
   beforeCursor = frontDummy;
   afterCursor = backDummy;
   pos_cursor = 0;
   num_elements = 0;
+  spare = nullptr;
+  arena.reset();
+  others.clear();
+  others_unique = 0;
 }
 
 // moveFront()
@@ -150,7 +253,7 @@ ListElement List::movePrev() {
 // insertBefore()
 // Inserts x before cursor.
 void List::insertBefore(ListElement x) {
-  Node* n = new Node(x);
+  Node* n = newNode(x);
   n->next = afterCursor;
   n->prev = beforeCursor;
   beforeCursor->next = n;
@@ -163,7 +266,7 @@ void List::insertBefore(ListElement x) {
 // insertAfter()
 // Inserts x after cursor.
 void List::insertAfter(ListElement x) {
-  Node* n = new Node(x);
+  Node* n = newNode(x);
   n->next = afterCursor;
   n->prev = beforeCursor;
   beforeCursor->next = n;
@@ -199,7 +302,7 @@ void List::eraseAfter() {
   Node* temp = afterCursor;
   beforeCursor->next = temp->next;
   temp->next->prev = beforeCursor;
-  delete temp;
+  freeNode(temp);
   afterCursor = beforeCursor->next;
   num_elements--;
 }
@@ -214,7 +317,7 @@ void List::eraseBefore() {
   beforeCursor = beforeCursor->prev;
   beforeCursor->next = afterCursor;
   afterCursor->prev = beforeCursor;
-  delete temp;
+  freeNode(temp);
   num_elements--;
   pos_cursor--;
 }
@@ -269,7 +372,7 @@ void List::cleanup() {
       cur = cur->next;
       temp->prev->next = temp->next;
       temp->next->prev = temp->prev;
-      delete temp;
+      freeNode(temp);
       num_elements--;
       if (index < old_pos) pos_cursor--;
     } else {
@@ -285,31 +388,68 @@ void List::cleanup() {
 // Returns a new List consisting of the elements of this List, followed by
 // the elements of L. The cursor in the returned List will be at postion 0.
 List List::concat(const List& L) const {
-  List c;
-  if (num_elements == 0) {
-    c = L;
-    c.moveFront();
-    return c;
-  }
-  if (L.num_elements == 0) {
-    c = *this;
-    c.moveFront();
-    return c;
-  }
-  Node* front = frontDummy->next;
-  for (int i = 0; i < length(); i++) {
-    c.insertAfter(front->data);
-    front = front->next;
-  }
-  Node* frontL = L.frontDummy->next;
-  for (int i = 0; i < L.length(); i++) {
-    c.insertAfter(frontL->data);
-    frontL = frontL->next;
+  List c = *this;
+  for (Node* N = L.frontDummy->next; N != L.backDummy; N = N->next) {
+    c.insertBefore(N->data);
   }
   c.moveFront();
   return c;
 }
 
+// concat()
+// As above, but splices the nodes of L in rather than copying them, and
+// leaves L empty.
+List List::concat(List&& L) const {
+  List c = *this;
+  c.splice(std::move(L));
+  c.moveFront();
+  return c;
+}
+
+// splice()
+// Moves all elements of L in before the cursor, in O(1), and places the
+// cursor after them. Takes over the spare nodes of L too, and L is left
+// empty with no pool.
+void List::splice(List&& L) {
+  if (&L == this || L.num_elements == 0) return;
+  shareArenas(L);
+  linkBeforeCursor(L.frontDummy->next, L.backDummy->prev, L.num_elements);
+  // this List now holds every Arena of L, so the spare nodes of L can join
+  // its own and L can let go of its pool
+  if (L.spare != nullptr) {
+    L.spare_last->next = spare;
+    if (spare == nullptr) spare_last = L.spare_last;
+    spare = L.spare;
+    L.spare = nullptr;
+  }
+  L.clear();
+}
+
+// splice()
+// Moves the n elements after the cursor of L in before the cursor of this
+// List, relinking their nodes, and places this cursor after them. The
+// cursor of L stays at the same position. O(n).
+// pre: 0 <= n <= L.length() - L.position()
+void List::splice(List& L, int n) {
+  if (n < 0 || n > L.num_elements - L.pos_cursor)
+    throw std::domain_error("Out of Bounds: Calling splice()");
+  if (n == 0) return;
+  if (&L == this) {
+    // the range is already right after the cursor
+    for (int i = 0; i < n; i++) moveNext();
+    return;
+  }
+  Node* first = L.afterCursor;
+  Node* last = first;
+  for (int i = 1; i < n; i++) last = last->next;
+  L.beforeCursor->next = last->next;
+  last->next->prev = L.beforeCursor;
+  L.afterCursor = last->next;
+  L.num_elements -= n;
+  shareArenas(L);
+  linkBeforeCursor(first, last, n);
+}
+
 // to_string()
 // Returns a string representation of this List consisting of a comma
 // separated sequence of elements, surrounded by parentheses.
@@ -358,12 +498,14 @@ bool operator==(const List& A, const List& B) { return A.equals(B); }
 List& List::operator=(const List& L) {
   if (this != &L) {
     List temp = L;
-    std::swap(frontDummy, temp.frontDummy);
-    std::swap(backDummy, temp.backDummy);
-    std::swap(afterCursor, temp.afterCursor);
-    std::swap(beforeCursor, temp.beforeCursor);
-    std::swap(pos_cursor, temp.pos_cursor);
-    std::swap(num_elements, temp.num_elements);
+    swapState(temp);
   }
   return *this;
 }
+
+// operator=()
+// Takes over the nodes of L in O(1). L is left in a valid state.
+List& List::operator=(List&& L) noexcept {
+  if (this != &L) swapState(L);
+  return *this;
+}
@@ -6,7 +6,9 @@
  */
 
 #include <iostream>
+#include <memory>
 #include <string>
+#include <vector>
 
 #ifndef List_H_INCLUDE_
 #define List_H_INCLUDE_
@@ -26,7 +28,9 @@ class List {
     Node(ListElement x);
   };
 
-  // List fields
+  // List fields. The dummies live in the List itself, so creating or moving
+  // a List allocates nothing; frontDummy and backDummy always point at them.
+  Node dummies[2];
   Node* frontDummy;
   Node* backDummy;
   Node* beforeCursor;
@@ -34,6 +38,53 @@ class List {
   int pos_cursor;
   int num_elements;
 
+  // Node pool: erased nodes are kept on the spare list (linked by next,
+  // ending at spare_last) and reused by later inserts. New nodes are carved
+  // from the blocks of an Arena, created on the first insert, which frees
+  // them once no List holds it. splice() moves nodes between Lists, so a
+  // List also holds every other Arena its nodes may have come from.
+  // Duplicates in others are only removed once it has doubled in size since
+  // the last cleanup, keeping splice() O(1) amortized. clear() drops the
+  // spare list and every Arena, since the List then holds no nodes.
+  struct Arena {
+    std::vector<Node*> blocks;
+    ~Arena();
+  };
+  Node* spare;
+  Node* spare_last;
+  std::shared_ptr<Arena> arena;
+  std::vector<std::shared_ptr<Arena>> others;
+  size_t others_unique;
+
+  // Helpers -----------------------------------------------------------------
+
+  // newNode()
+  // Returns a node holding x, taken from the spare list. Allocates a new
+  // block, twice the size of the last one, when the spare list is empty.
+  Node* newNode(ListElement x);
+
+  // freeNode()
+  // Returns N to the spare list.
+  void freeNode(Node* N);
+
+  // swapState()
+  // Exchanges the nodes, cursor and pool of this List with those of L.
+  void swapState(List& L) noexcept;
+
+  // relinkDummies()
+  // Called by swapState(): points the links and cursor of this List that
+  // still refer to the dummies of L at its own.
+  void relinkDummies(const List& L) noexcept;
+
+  // shareArenas()
+  // Makes this List hold every Arena that L holds.
+  void shareArenas(const List& L);
+
+  // linkBeforeCursor()
+  // Links the n nodes first..last in before the cursor, leaving the cursor
+  // after them.
+  void linkBeforeCursor(Node* first, Node* last, int n);
+
  public:
   // Class Constructors & Destructors ----------------------------------------
 
@@ -43,6 +94,9 @@ class List {
   // Copy constructor.
   List(const List& L);
 
+  // Move constructor. L is left empty. Allocates nothing.
+  List(List&& L) noexcept;
+
   // Destructor
   ~List();
 
@@ -79,7 +133,8 @@ class List {
   // Manipulation procedures -------------------------------------------------
 
   // clear()
-  // Deletes all elements in this List, setting it to the empty state.
+  // Deletes all elements in this List, setting it to the empty state, and
+  // releases its node pool.
   void clear();
 
   // moveFront()
@@ -161,6 +216,24 @@ class List {
   // the elements of L. The cursor in the returned List will be at postion 0.
   List concat(const List& L) const;
 
+  // concat()
+  // As above, but splices the nodes of L in rather than copying them, and
+  // leaves L empty.
+  List concat(List&& L) const;
+
+  // splice()
+  // Moves all elements of L in before the cursor, in O(1), and places the
+  // cursor after them. Takes over the spare nodes of L too, and L is left
+  // empty with no pool.
+  void splice(List&& L);
+
+  // splice()
+  // Moves the n elements after the cursor of L in before the cursor of this
+  // List, relinking their nodes, and places this cursor after them. The
+  // cursor of L stays at the same position. O(n).
+  // pre: 0 <= n <= L.length() - L.position()
+  void splice(List& L, int n);
+
   // to_string()
   // Returns a string representation of this List consisting of a comma
   // separated sequence of elements, surrounded by parentheses.
@@ -185,6 +258,10 @@ class List {
   // operator=()
   // Overwrites the state of this List with state of L.
   List& operator=(const List& L);
+
+  // operator=()
+  // Takes over the nodes of L in O(1). L is left in a valid state.
+  List& operator=(List&& L) noexcept;
 };
 
 #endif
\ No newline at end of file
@@ -7,12 +7,19 @@
 
 #include <cassert>
 #include <iostream>
+#include <type_traits>
+#include <utility>
 
 #include "List.h"
 
 using std::cout;
 using std::endl;
 
+// vector<List> moves its Lists when it grows only if they cannot throw
+static_assert(std::is_nothrow_move_constructible<List>::value &&
+                  std::is_nothrow_move_assignable<List>::value,
+              "List moves should be noexcept");
+
 void testEmptyList() {
   cout << "=== Test Empty List ===" << endl;
   List L;
@@ -162,6 +169,7 @@ void testConcatAndCopy() {
   List L3 = L1.concat(L2);
   cout << "Concatenated list L3: " << L3 << endl;
   assert(L3.length() == 6);
+  assert(L3.to_string() == "(1, 2, 3, 4, 5, 6)" && L3.position() == 0);
 
   List L4 = L3;
   assert(L4 == L3);
@@ -173,6 +181,100 @@ void testConcatAndCopy() {
   cout << "Copy and assignment tests passed." << endl << endl;
 }
 
+// Builds the list (from, ..., to) with the cursor at the back.
+List makeRange(int from, int to) {
+  List L;
+  for (int i = from; i <= to; i++) L.insertBefore(i);
+  return L;
+}
+
+void testMoveAndSplice() {
+  cout << "=== Test move constructor, move assignment, splice, and concat ==="
+       << endl;
+  List L1 = makeRange(1, 3);
+  List L2(std::move(L1));
+  assert(L2.to_string() == "(1, 2, 3)" && L2.position() == 3);
+  assert(L1.length() == 0 && L1.position() == 0);
+  L1 = std::move(L2);
+  assert(L1.to_string() == "(1, 2, 3)" && L2.length() == 0);
+  // the dummies stay in each List, so a cursor on them must follow the move
+  List L5 = makeRange(1, 3);
+  L5.moveFront();
+  List L6(std::move(L5));
+  L6.insertBefore(0);
+  L5.insertBefore(4);
+  assert(L6.to_string() == "(0, 1, 2, 3)" && L6.position() == 1);
+  assert(L5.to_string() == "(4)" && L5.position() == 1);
+  L5 = std::move(L6);
+  assert(L5.to_string() == "(0, 1, 2, 3)" && L6.to_string() == "(4)");
+  L6.movePrev();
+  L6.insertBefore(5);
+  assert(L6.to_string() == "(5, 4)" && L6.peekNext() == 4);
+
+  // splice a whole List in before the cursor
+  L1.moveFront();
+  L1.moveNext();
+  L1.splice(makeRange(7, 9));
+  assert(L1.to_string() == "(1, 7, 8, 9, 2, 3)");
+  assert(L1.position() == 4 && L1.peekNext() == 2 && L1.peekPrev() == 9);
+  L1.splice(List());
+  assert(L1.length() == 6 && L1.position() == 4);
+
+  // the spliced nodes outlive the List they came from
+  {
+    List temp = makeRange(10, 11);
+    L1.moveBack();
+    L1.splice(std::move(temp));
+    temp.insertBefore(12);
+    assert(temp.to_string() == "(12)");
+  }
+  assert(L1.back() == 11 && L1.length() == 8);
+
+  // splice a range from the cursor of another List
+  List L3 = makeRange(20, 25);
+  L3.moveFront();
+  L3.moveNext();
+  L1.moveFront();
+  L1.splice(L3, 3);
+  assert(L1.to_string() == "(21, 22, 23, 1, 7, 8, 9, 2, 3, 10, 11)");
+  assert(L1.position() == 3);
+  assert(L3.to_string() == "(20, 24, 25)" && L3.position() == 1);
+  assert(L3.peekNext() == 24);
+  L1.splice(L3, 0);
+  L1.splice(L1, 2);
+  assert(L1.position() == 5 && L1.length() == 11);
+  try {
+    L1.splice(L3, 3);
+    assert(false && "splice() past the back should throw");
+  } catch (std::domain_error &) {
+  }
+
+  // clear() drops the pool, and the next insert starts a new one
+  L1.clear();
+  for (int i = 0; i < 5; i++) L1.insertBefore(i);
+  assert(L1.to_string() == "(0, 1, 2, 3, 4)");
+
+  // each splice takes over the spare nodes of the List it empties, which
+  // the spliced-from List can still reuse for new ones
+  for (int i = 0; i < 1000; i++) {
+    List temp;
+    temp.insertBefore(i);
+    temp.insertBefore(i);
+    temp.eraseBefore();
+    L1.splice(std::move(temp));
+    temp.insertBefore(-i);
+    assert(temp.to_string() == "(" + std::to_string(-i) + ")");
+    if (i % 100 == 99) L1.clear();
+  }
+  assert(L1.length() == 0);
+  L1.insertBefore(7);
+  assert(L1.to_string() == "(7)");
+
+  List L4 = makeRange(1, 2).concat(makeRange(3, 4));
+  assert(L4.to_string() == "(1, 2, 3, 4)" && L4.position() == 0);
+  cout << "Move and splice tests passed." << endl << endl;
+}
+
 void testToStringAndEquals() {
   cout << "=== Test to_string() and equals() ===" << endl;
   List L;
@@ -206,6 +308,7 @@ int main() {
   testSetAndErase();
   testFindAndCleanup();
   testConcatAndCopy();
+  testMoveAndSplice();
   testToStringAndEquals();
 
   // Test movePrev by traversing backward and printing each value.
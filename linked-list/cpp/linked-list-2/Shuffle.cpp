@@ -1,63 +1,43 @@
 /**
  * @author Ethan Okamura
  * @file Shuffle.cpp
- * @brief Performs a perfect shuffle using the List ADT
+ * @brief Performs a perfect shuffle using the unrolled List ADT, or computes
+ *        the shuffle counts from permutation cycles with -c
  */
 
+#include <cstring>
 #include <iomanip>
+#include <thread>
 
-#include "List.h"
-
-// O(n)
-void shuffle(List& D) {
-  List first;
-  int mid = D.length() / 2;
-  // split
-  D.moveFront();
-  for (int i = 0; i < mid; i++) {
-    first.insertBefore(D.peekNext());
-    D.eraseAfter();
-  }
-  // merge
-  first.moveFront();
-  for (int i = 0; i < mid; i++) {
-    D.moveNext();
-    D.insertAfter(first.peekNext());
-    D.moveNext();
-    first.eraseAfter();
-  }
-}
-
-// O(n * nPi)
-int getShuffleCount(List& D, int i) {
-  int count{};
-  D.insertBefore(i);
-  if (i < 2) return i + 1;
-  List shuffled_deck = D;
-  // O(n)
-  shuffle(shuffled_deck);
-  count++;
-  // O(nPi)
-  while (!(shuffled_deck == D)) {
-    // O(n)
-    shuffle(shuffled_deck);
-    count++;
-  }
-  return count;
-}
+#include "Shuffle.h"
+#include "ShuffleOrder.h"
+#include "UnrolledList.h"
 
+// Usage: Shuffle <deck size> [-c [threads]]
 int main(int argc, char** argv) {
-  if (argc != 2) return -1;
+  bool cycles = argc >= 3 && std::strcmp(argv[2], "-c") == 0;
+  if (argc != 2 && !(cycles && argc <= 4)) return -1;
   int deck_size = std::stoi(argv[1]);
-  List deck;
   std::cout << std::left << std::setw(16) << "deck size"
             << "shuffle count" << std::endl;
   for (int i = 0; i < 30; i++) std::cout << '-';
   std::cout << '\n';
+  if (cycles) {
+    // O(n) per deck size, spread over the threads
+    unsigned threads = argc == 4 ? std::stoul(argv[3])
+                                 : std::thread::hardware_concurrency();
+    std::vector<long> counts = shuffleOrders(deck_size, threads ? threads : 1);
+    for (int i = 0; i < deck_size; i++) {
+      std::cout << ' ' << std::left << std::setw(16) << i + 1 << counts[i]
+                << '\n';
+    }
+    return 0;
+  }
+  UnrolledList deck;
   // O(n)
   for (int i = 0; i < deck_size; i++) {
     int count = getShuffleCount(deck, i);
     std::cout << ' ' << std::left << std::setw(16) << i + 1 << count << '\n';
   }
   return 0;
-}
\ No newline at end of file
+}
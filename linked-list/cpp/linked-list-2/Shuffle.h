@@ -0,0 +1,51 @@
+/**
+ * @author Ethan Okamura
+ * @file Shuffle.h
+ * @brief Perfect shuffle routines, templated so that they run on both List
+ *        and UnrolledList
+ */
+
+#ifndef SHUFFLE_H_INCLUDE_
+#define SHUFFLE_H_INCLUDE_
+
+// O(n)
+template <typename Deck>
+void shuffle(Deck& D) {
+  Deck first;
+  int mid = D.length() / 2;
+  // split
+  D.moveFront();
+  for (int i = 0; i < mid; i++) {
+    first.insertBefore(D.peekNext());
+    D.eraseAfter();
+  }
+  // merge
+  first.moveFront();
+  for (int i = 0; i < mid; i++) {
+    D.moveNext();
+    D.insertAfter(first.peekNext());
+    D.moveNext();
+    first.eraseAfter();
+  }
+}
+
+// O(n * nPi)
+template <typename Deck>
+int getShuffleCount(Deck& D, int i) {
+  int count{};
+  D.insertBefore(i);
+  if (i < 2) return i + 1;
+  Deck shuffled_deck = D;
+  // O(n)
+  shuffle(shuffled_deck);
+  count++;
+  // O(nPi)
+  while (!(shuffled_deck == D)) {
+    // O(n)
+    shuffle(shuffled_deck);
+    count++;
+  }
+  return count;
+}
+
+#endif
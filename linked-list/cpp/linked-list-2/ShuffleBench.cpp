@@ -0,0 +1,105 @@
+/**
+ * @author Ethan Okamura
+ * @file ShuffleBench.cpp
+ * @brief Times the Shuffle sweep on List and on UnrolledList, and the
+ *        cycle-based counts on one thread and on all of them (read README.md)
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "List.h"
+#include "Shuffle.h"
+#include "ShuffleOrder.h"
+#include "UnrolledList.h"
+
+// Runs the Shuffle sweep over decks 1..deck_size, storing every shuffle count
+// in counts, and returns the seconds taken.
+template <typename Deck>
+double sweep(int deck_size, std::vector<int>& counts) {
+  Deck deck;
+  counts.clear();
+  std::clock_t time = std::clock();  // start
+  for (int i = 0; i < deck_size; i++) {
+    counts.push_back(getShuffleCount(deck, i));
+  }
+  time = std::clock() - time;  // stop
+  return static_cast<double>(time) / CLOCKS_PER_SEC;
+}
+
+// Builds a list of n elements, then returns the seconds taken by passes
+// full-length searches for a missing element.
+template <typename Deck>
+double traverse(int n, int passes) {
+  Deck deck;
+  for (int i = 0; i < n; i++) deck.insertBefore(i);
+  std::clock_t time = std::clock();  // start
+  for (int p = 0; p < passes; p++) {
+    deck.moveFront();
+    deck.findNext(-1);
+  }
+  time = std::clock() - time;  // stop
+  return static_cast<double>(time) / CLOCKS_PER_SEC;
+}
+
+// Returns the wall-clock seconds taken by shuffleOrders(deck_size, threads),
+// storing the counts in orders.
+double cycleSweep(int deck_size, unsigned threads, std::vector<long>& orders) {
+  auto start = std::chrono::steady_clock::now();
+  orders = shuffleOrders(deck_size, threads);
+  std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+  return time.count();
+}
+
+int main(int argc, char** argv) {
+  int deck_size = argc > 1 ? std::stoi(argv[1]) : 1000;
+  std::vector<int> list_counts, unrolled_counts;
+  double list = sweep<List>(deck_size, list_counts);
+  double unrolled = sweep<UnrolledList>(deck_size, unrolled_counts);
+  if (list_counts != unrolled_counts) {
+    std::cerr << "ShuffleBench: shuffle counts differ\n";
+    return EXIT_FAILURE;
+  }
+  std::cout << "--- decks 1.." << deck_size << " ---\n";
+  std::cout << "List: " << list << " s\n";
+  std::cout << "UnrolledList: " << unrolled << " s (" << list / unrolled
+            << "x)\n";
+
+  std::vector<long> orders;
+  double cycles = cycleSweep(deck_size, 1, orders);
+  if (std::vector<long>(list_counts.begin(), list_counts.end()) != orders) {
+    std::cerr << "ShuffleBench: cycle counts differ\n";
+    return EXIT_FAILURE;
+  }
+  std::cout << "cycles: " << cycles << " s (" << list / cycles << "x)\n";
+
+  const int big_decks = 10 * deck_size;
+  unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+  std::vector<long> parallel_orders;
+  double one = cycleSweep(big_decks, 1, orders);
+  double all = cycleSweep(big_decks, threads, parallel_orders);
+  if (orders != parallel_orders) {
+    std::cerr << "ShuffleBench: threaded cycle counts differ\n";
+    return EXIT_FAILURE;
+  }
+  std::cout << "--- cycles, decks 1.." << big_decks << " ---\n";
+  std::cout << "1 thread: " << one << " s\n";
+  std::cout << threads << (threads == 1 ? " thread: " : " threads: ") << all << " s (" << one / all
+            << "x)\n";
+
+  const int n = 1000000, passes = 20;
+  double list_walk = traverse<List>(n, passes);
+  double unrolled_walk = traverse<UnrolledList>(n, passes);
+  std::cout << "--- " << passes << " findNext() passes over " << n
+            << " elements ---\n";
+  std::cout << "List: " << list_walk << " s\n";
+  std::cout << "UnrolledList: " << unrolled_walk << " s ("
+            << list_walk / unrolled_walk << "x)\n";
+  return EXIT_SUCCESS;
+}
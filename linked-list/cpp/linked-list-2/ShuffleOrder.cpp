@@ -0,0 +1,72 @@
+/**
+ * @author Ethan Okamura
+ * @file ShuffleOrder.cpp
+ * @brief Implementation of the cycle-based perfect shuffle counts
+ * @status: working / tested
+ */
+
+#include "ShuffleOrder.h"
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+
+// shufflePermutation()
+// Returns P where one shuffle() of a deck of n cards moves the card at index
+// i to index P[i]. The second half of the deck ends up in the even indices,
+// the first half in the odd ones.
+// pre: n >= 0
+std::vector<int> shufflePermutation(int n) {
+  if (n < 0) throw std::invalid_argument("shufflePermutation: n < 0");
+  std::vector<int> P(n);
+  int mid = n / 2;
+  for (int i = 0; i < mid; i++) P[i] = 2 * i + 1;
+  for (int i = mid; i < n; i++) P[i] = 2 * (i - mid);
+  return P;
+}
+
+// shuffleOrder()
+// Returns the number of shuffles that return a deck of n cards to its
+// original order: the LCM of the cycle lengths of shufflePermutation(n).
+// O(n).
+// pre: n >= 1
+long shuffleOrder(int n) {
+  if (n < 1) throw std::invalid_argument("shuffleOrder: n < 1");
+  std::vector<int> P = shufflePermutation(n);
+  std::vector<char> seen(n, 0);
+  const int* next = P.data();
+  char* visited = seen.data();
+  long order = 1;
+  for (int i = 0; i < n; i++) {
+    if (visited[i]) continue;
+    long length = 0;
+    for (int j = i; !visited[j]; j = next[j]) {
+      visited[j] = 1;
+      length++;
+    }
+    order = std::lcm(order, length);
+  }
+  return order;
+}
+
+// shuffleOrders()
+// Returns shuffleOrder(n) for n = 1..deck_size, at index n - 1, computed on
+// the given number of threads. Deck sizes are handed out one at a time, so
+// the larger (slower) sizes spread evenly across the threads.
+// pre: threads >= 1
+std::vector<long> shuffleOrders(int deck_size, unsigned threads) {
+  if (threads == 0) throw std::invalid_argument("shuffleOrders: 0 threads");
+  std::vector<long> orders(deck_size > 0 ? deck_size : 0);
+  std::atomic<int> next(1);
+  auto work = [&] {
+    for (int n = next++; n <= deck_size; n = next++) {
+      orders[n - 1] = shuffleOrder(n);
+    }
+  };
+  std::vector<std::thread> workers;
+  for (unsigned t = 1; t < threads; t++) workers.emplace_back(work);
+  work();
+  for (std::thread& worker : workers) worker.join();
+  return orders;
+}
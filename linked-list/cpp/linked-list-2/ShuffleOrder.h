@@ -0,0 +1,35 @@
+/**
+ * @author Ethan Okamura
+ * @file ShuffleOrder.h
+ * @brief Computes perfect shuffle counts from the cycles of the shuffle
+ *        permutation instead of shuffling a List until it returns
+ * @status: working / tested
+ */
+
+#include <vector>
+
+#ifndef SHUFFLE_ORDER_H_INCLUDE_
+#define SHUFFLE_ORDER_H_INCLUDE_
+
+// shufflePermutation()
+// Returns P where one shuffle() of a deck of n cards moves the card at index
+// i to index P[i]. The second half of the deck ends up in the even indices,
+// the first half in the odd ones.
+// pre: n >= 0
+std::vector<int> shufflePermutation(int n);
+
+// shuffleOrder()
+// Returns the number of shuffles that return a deck of n cards to its
+// original order: the LCM of the cycle lengths of shufflePermutation(n).
+// O(n).
+// pre: n >= 1
+long shuffleOrder(int n);
+
+// shuffleOrders()
+// Returns shuffleOrder(n) for n = 1..deck_size, at index n - 1, computed on
+// the given number of threads. Deck sizes are handed out one at a time, so
+// the larger (slower) sizes spread evenly across the threads.
+// pre: threads >= 1
+std::vector<long> shuffleOrders(int deck_size, unsigned threads);
+
+#endif
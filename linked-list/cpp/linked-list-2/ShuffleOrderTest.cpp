@@ -0,0 +1,55 @@
+/**
+ * @author Ethan Okamura
+ * @file ShuffleOrderTest.cpp
+ * @brief Main testing file for the cycle-based shuffle counts
+ * @status: working / tested
+ */
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+#include "List.h"
+#include "Shuffle.h"
+#include "ShuffleOrder.h"
+
+using std::cout;
+using std::endl;
+
+void testPermutation() {
+  cout << "=== Test shufflePermutation ===" << endl;
+  // (0 1 2 3 4) shuffles to (2 0 3 1 4)
+  assert(shufflePermutation(5) == std::vector<int>({1, 3, 0, 2, 4}));
+  assert(shufflePermutation(0).empty());
+
+  // applying the permutation matches one shuffle() of a List
+  List deck;
+  for (int i = 0; i < 9; i++) deck.insertBefore(i);
+  shuffle(deck);
+  std::vector<int> P = shufflePermutation(9);
+  for (int i = 0; i < 9; i++) {
+    deck.moveFront();
+    for (int j = 0; j < P[i]; j++) deck.moveNext();
+    assert(deck.peekNext() == i);
+  }
+  cout << "Permutation tests passed." << endl << endl;
+}
+
+void testOrders() {
+  cout << "=== Test shuffleOrder and shuffleOrders ===" << endl;
+  List deck;
+  for (int i = 0; i < 200; i++) {
+    assert(shuffleOrder(i + 1) == getShuffleCount(deck, i));
+  }
+  // the threaded sweep gives the same table as one thread
+  assert(shuffleOrders(2000, 4) == shuffleOrders(2000, 1));
+  assert(shuffleOrders(0, 2).empty());
+  cout << "Order tests passed." << endl << endl;
+}
+
+int main() {
+  testPermutation();
+  testOrders();
+  cout << "All tests passed." << endl;
+  return 0;
+}
@@ -0,0 +1,79 @@
+/**
+ * @author Ethan Okamura
+ * @file SpliceBench.cpp
+ * @brief Times building one long List from many fragments by copying,
+ *        by repeated concat(), and by splice() (read README.md)
+ */
+
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "List.h"
+
+// Returns count fragments of size elements each, numbered consecutively.
+std::vector<List> makeFragments(int count, int size) {
+  std::vector<List> fragments(count);
+  for (int f = 0; f < count; f++) {
+    for (int i = 0; i < size; i++) fragments[f].insertBefore(f * size + i);
+  }
+  return fragments;
+}
+
+// Returns the seconds taken by build(fragments, R), after checking that R
+// holds 0, 1, ..., count * size - 1.
+template <typename Build>
+double timeBuild(const char* name, int count, int size, Build build) {
+  std::vector<List> fragments = makeFragments(count, size);
+  List R;
+  std::clock_t time = std::clock();  // start
+  build(fragments, R);
+  time = std::clock() - time;  // stop
+  R.moveFront();
+  for (int i = 0; i < count * size; i++) {
+    if (R.moveNext() != i) {
+      std::cerr << "SpliceBench: " << name << " built the wrong List\n";
+      std::exit(EXIT_FAILURE);
+    }
+  }
+  double seconds = static_cast<double>(time) / CLOCKS_PER_SEC;
+  std::cout << name << ": " << seconds << " s\n";
+  return seconds;
+}
+
+int main(int argc, char** argv) {
+  int count = argc > 1 ? std::stoi(argv[1]) : 10000;
+  int size = argc > 2 ? std::stoi(argv[2]) : 1000;
+  // concat() copies everything built so far, so only a few fragments
+  int concat_count = argc > 3 ? std::stoi(argv[3]) : 100;
+
+  std::cout << "--- " << concat_count << " fragments of " << size
+            << " ---\n";
+  timeBuild("concat", concat_count, size,
+            [](std::vector<List>& fragments, List& R) {
+              for (List& F : fragments) R = R.concat(F);
+            });
+  timeBuild("concat(List&&)", concat_count, size,
+            [](std::vector<List>& fragments, List& R) {
+              for (List& F : fragments) R = R.concat(std::move(F));
+            });
+
+  std::cout << "--- " << count << " fragments of " << size << " ---\n";
+  double copy = timeBuild("insertBefore", count, size,
+                          [](std::vector<List>& fragments, List& R) {
+                            for (List& F : fragments) {
+                              F.moveFront();
+                              while (F.position() < F.length())
+                                R.insertBefore(F.moveNext());
+                            }
+                          });
+  double splice = timeBuild("splice", count, size,
+                            [](std::vector<List>& fragments, List& R) {
+                              for (List& F : fragments) R.splice(std::move(F));
+                            });
+  std::cout << "splice is " << copy / splice << "x faster\n";
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,591 @@
+/**
+ * @author Ethan Okamura
+ * @file UnrolledList.cpp
+ * @brief Implementation of the unrolled List ADT
+ * @status: working / tested
+ */
+
+#include "UnrolledList.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
+
+#include "../simd/FindKernels.h"
+
+// searchLevel()
+// Returns the SimdLevel findNext() and findPrev() search blocks with,
+// detected on first use.
+SimdLevel searchLevel() {
+  static const SimdLevel level = detectSimdLevel();
+  return level;
+}
+
+UnrolledList::Block::Block()
+    : start(0), count(0), next(nullptr), prev(nullptr) {}
+
+// insert()
+// Inserts x before element i, moving whichever side is shorter.
+// pre: count < BLOCK_CAPACITY
+void UnrolledList::Block::insert(int i, ListElement x) {
+  bool room_front = start > 0, room_back = start + count < BLOCK_CAPACITY;
+  if (room_front && (i < count / 2 || !room_back)) {
+    if (i > 0)
+      std::memmove(data + start - 1, data + start, i * sizeof(ListElement));
+    start--;
+  } else if (i < count) {
+    std::memmove(data + start + i + 1, data + start + i,
+                 (count - i) * sizeof(ListElement));
+  }
+  data[start + i] = x;
+  count++;
+}
+
+// erase()
+// Deletes element i, moving whichever side is shorter.
+void UnrolledList::Block::erase(int i) {
+  if (i < count / 2) {
+    if (i > 0)
+      std::memmove(data + start + 1, data + start, i * sizeof(ListElement));
+    start++;
+  } else if (i < count - 1) {
+    std::memmove(data + start + i, data + start + i + 1,
+                 (count - i - 1) * sizeof(ListElement));
+  }
+  count--;
+}
+
+// Helpers -----------------------------------------------------------------
+
+// linkBlock()
+// Returns a new empty block linked in after B, or at the front if B is
+// nullptr.
+UnrolledList::Block* UnrolledList::linkBlock(Block* B) {
+  Block* N = new Block();
+  N->prev = B;
+  N->next = B ? B->next : head;
+  if (N->next)
+    N->next->prev = N;
+  else
+    tail = N;
+  if (B)
+    B->next = N;
+  else
+    head = N;
+  return N;
+}
+
+// unlinkBlock()
+// Unlinks and deletes B.
+void UnrolledList::unlinkBlock(Block* B) {
+  if (B->prev)
+    B->prev->next = B->next;
+  else
+    head = B->next;
+  if (B->next)
+    B->next->prev = B->prev;
+  else
+    tail = B->prev;
+  delete B;
+}
+
+// mergeNext()
+// Moves the elements of B->next onto the end of B and deletes B->next.
+// pre: B->count + B->next->count <= BLOCK_CAPACITY
+void UnrolledList::mergeNext(Block* B) {
+  Block* N = B->next;
+  if (B->start + B->count + N->count > BLOCK_CAPACITY) {
+    std::memmove(B->data, B->data + B->start,
+                 B->count * sizeof(ListElement));
+    B->start = 0;
+  }
+  std::memcpy(B->data + B->start + B->count, N->data + N->start,
+              N->count * sizeof(ListElement));
+  if (cursorBlock == N) {
+    cursorBlock = B;
+    cursorIndex += B->count;
+  }
+  B->count += N->count;
+  unlinkBlock(N);
+}
+
+// normalize()
+// Moves a cursor sitting past the last element of a block to the front of
+// the next block.
+void UnrolledList::normalize() {
+  if (cursorBlock && cursorIndex == cursorBlock->count && cursorBlock->next) {
+    cursorBlock = cursorBlock->next;
+    cursorIndex = 0;
+  }
+}
+
+// insertAtCursor()
+// Inserts x after the cursor without moving it.
+void UnrolledList::insertAtCursor(ListElement x) {
+  if (!cursorBlock) {
+    cursorBlock = linkBlock(nullptr);
+    cursorIndex = 0;
+  } else if (cursorBlock->count == BLOCK_CAPACITY) {
+    Block* P = cursorBlock->prev;
+    if (cursorIndex == 0 && P && P->count < BLOCK_CAPACITY) {
+      // the previous block has room at its end
+      cursorBlock = P;
+      cursorIndex = P->count;
+    } else if (cursorIndex == BLOCK_CAPACITY) {
+      // at the back: start a new block, so appending packs blocks full
+      cursorBlock = linkBlock(cursorBlock);
+      cursorIndex = 0;
+    } else {
+      // split in half, centring both halves so either side can grow
+      const int half = BLOCK_CAPACITY / 2, margin = half / 2;
+      Block* B = cursorBlock;
+      Block* N = linkBlock(B);
+      std::memcpy(N->data + margin, B->data + half,
+                  (BLOCK_CAPACITY - half) * sizeof(ListElement));
+      N->start = margin;
+      N->count = BLOCK_CAPACITY - half;
+      std::memmove(B->data + margin, B->data, half * sizeof(ListElement));
+      B->start = margin;
+      B->count = half;
+      if (cursorIndex > half) {
+        cursorBlock = N;
+        cursorIndex -= half;
+      }
+    }
+  }
+  cursorBlock->insert(cursorIndex, x);
+  num_elements++;
+}
+
+// eraseAtCursor()
+// Deletes the element after the cursor without moving it, merging small
+// neighbouring blocks.
+// pre: position()<length()
+void UnrolledList::eraseAtCursor() {
+  Block* B = cursorBlock;
+  B->erase(cursorIndex);
+  num_elements--;
+  if (B->count == 0) {
+    if (B->next) {
+      cursorBlock = B->next;
+      cursorIndex = 0;
+    } else if (B->prev) {
+      cursorBlock = B->prev;
+      cursorIndex = B->prev->count;
+    } else {
+      cursorBlock = nullptr;
+      cursorIndex = 0;
+    }
+    unlinkBlock(B);
+    return;
+  }
+  if (cursorIndex == B->count && B->next) {
+    cursorBlock = B->next;
+    cursorIndex = 0;
+  }
+  const int half = BLOCK_CAPACITY / 2;
+  if (B->next && B->count + B->next->count <= half) {
+    mergeNext(B);
+  } else if (B->prev && B->prev->count + B->count <= half) {
+    mergeNext(B->prev);
+  }
+}
+
+// pushBack()
+// Appends x to the back, packing blocks full. Leaves the cursor alone.
+void UnrolledList::pushBack(ListElement x) {
+  if (!tail || tail->start + tail->count == BLOCK_CAPACITY) linkBlock(tail);
+  tail->data[tail->start + tail->count++] = x;
+  num_elements++;
+}
+
+// beforeCursor()
+// Returns the element before the cursor.
+// pre: position()>0
+ListElement& UnrolledList::beforeCursor() const {
+  if (cursorIndex > 0)
+    return cursorBlock->data[cursorBlock->start + cursorIndex - 1];
+  Block* P = cursorBlock->prev;
+  return P->data[P->start + P->count - 1];
+}
+
+// seek()
+// Places the cursor at position pos, walking from the nearer end.
+// pre: 0 <= pos <= length()
+void UnrolledList::seek(int pos) {
+  pos_cursor = pos;
+  if (num_elements == 0) return;
+  if (pos <= num_elements / 2) {
+    Block* B = head;
+    while (pos >= B->count && B->next) {
+      pos -= B->count;
+      B = B->next;
+    }
+    cursorBlock = B;
+    cursorIndex = pos;
+  } else {
+    // after = number of elements after the cursor
+    Block* B = tail;
+    int after = num_elements - pos;
+    while (after > B->count) {
+      after -= B->count;
+      B = B->prev;
+    }
+    cursorBlock = B;
+    cursorIndex = B->count - after;
+    normalize();
+  }
+}
+
+// rebuild()
+// Replaces the elements with E, packed into full blocks, and places the
+// cursor at position pos.
+void UnrolledList::rebuild(const std::vector<ListElement>& E, int pos) {
+  clear();
+  for (ListElement x : E) pushBack(x);
+  seek(pos);
+}
+
+// Class Constructors & Destructors ----------------------------------------
+
+// Creates new UnrolledList in the empty state.
+UnrolledList::UnrolledList()
+    : head(nullptr),
+      tail(nullptr),
+      cursorBlock(nullptr),
+      cursorIndex(0),
+      pos_cursor(0),
+      num_elements(0) {}
+
+// Copy constructor.
+UnrolledList::UnrolledList(const UnrolledList& L) : UnrolledList() {
+  for (Block* B = L.head; B; B = B->next) {
+    for (int i = 0; i < B->count; i++) pushBack(B->data[B->start + i]);
+  }
+  moveBack();
+}
+
+// Destructor
+UnrolledList::~UnrolledList() { clear(); }
+
+// Access functions --------------------------------------------------------
+
+// length()
+// Returns the length of this List.
+int UnrolledList::length() const { return num_elements; }
+
+// front()
+// Returns the front element in this List.
+// pre: length()>0
+ListElement UnrolledList::front() const {
+  if (num_elements == 0) throw std::logic_error("Empty List: Calling front()");
+  return head->data[head->start + 0];
+}
+
+// back()
+// Returns the back element in this List.
+// pre: length()>0
+ListElement UnrolledList::back() const {
+  if (num_elements == 0) throw std::logic_error("Empty List: Calling back()");
+  return tail->data[tail->start + tail->count - 1];
+}
+
+// position()
+// Returns the position of cursor in this List: 0 <= position() <= length().
+int UnrolledList::position() const { return pos_cursor; }
+
+// peekNext()
+// Returns the element after the cursor.
+// pre: position()<length()
+ListElement UnrolledList::peekNext() const {
+  if (pos_cursor >= num_elements)
+    throw std::domain_error("Out of Bounds: Calling peekNext()");
+  return cursorBlock->data[cursorBlock->start + cursorIndex];
+}
+
+// peekPrev()
+// Returns the element before the cursor.
+// pre: position()>0
+ListElement UnrolledList::peekPrev() const {
+  if (pos_cursor <= 0)
+    throw std::domain_error("Out of Bounds: Calling peekPrev()");
+  return beforeCursor();
+}
+
+// Manipulation procedures -------------------------------------------------
+
+// clear()
+// Deletes all elements in this List, setting it to the empty state.
+void UnrolledList::clear() {
+  Block* current = head;
+  while (current != nullptr) {
+    Block* next = current->next;
+    delete current;
+    current = next;
+  }
+  head = tail = cursorBlock = nullptr;
+  cursorIndex = 0;
+  pos_cursor = 0;
+  num_elements = 0;
+}
+
+// moveFront()
+// Moves cursor to position 0 in this List.
+void UnrolledList::moveFront() {
+  if (num_elements == 0) return;
+  cursorBlock = head;
+  cursorIndex = 0;
+  pos_cursor = 0;
+}
+
+// moveBack()
+// Moves cursor to position length() in this List.
+void UnrolledList::moveBack() {
+  if (num_elements == 0) return;
+  cursorBlock = tail;
+  cursorIndex = tail->count;
+  pos_cursor = num_elements;
+}
+
+// moveNext()
+// Advances cursor to next higher position. Returns the List element that
+// was passed over.
+// pre: position()<length()
+ListElement UnrolledList::moveNext() {
+  if (pos_cursor >= num_elements)
+    throw std::domain_error("Out of Bounds: Calling moveNext()");
+  Block* B = cursorBlock;
+  ListElement x = B->data[B->start + cursorIndex++];
+  pos_cursor++;
+  if (cursorIndex == B->count && B->next) {
+    cursorBlock = B->next;
+    cursorIndex = 0;
+  }
+  return x;  // Return passed-over element
+}
+
+// movePrev()
+// Advances cursor to next lower position. Returns the List element that
+// was passed over.
+// pre: position()>0
+ListElement UnrolledList::movePrev() {
+  if (pos_cursor <= 0)
+    throw std::domain_error("Out of Bounds: Calling movePrev()");
+  if (cursorIndex == 0) {
+    cursorBlock = cursorBlock->prev;
+    cursorIndex = cursorBlock->count;
+  }
+  pos_cursor--;
+  return cursorBlock->data[cursorBlock->start + --cursorIndex];
+}
+
+// insertBefore()
+// Inserts x before cursor.
+void UnrolledList::insertBefore(ListElement x) {
+  insertAtCursor(x);
+  cursorIndex++;
+  pos_cursor++;
+  normalize();
+}
+
+// insertAfter()
+// Inserts x after cursor.
+void UnrolledList::insertAfter(ListElement x) { insertAtCursor(x); }
+
+// setAfter()
+// Overwrites the List element after the cursor with x.
+// pre: position()<length()
+void UnrolledList::setAfter(ListElement x) {
+  if (pos_cursor >= num_elements)
+    throw std::domain_error("Out of Bounds: Calling setAfter()");
+  cursorBlock->data[cursorBlock->start + cursorIndex] = x;
+}
+
+// setBefore()
+// Overwrites the List element before the cursor with x.
+// pre: position()>0
+void UnrolledList::setBefore(ListElement x) {
+  if (pos_cursor <= 0)
+    throw std::domain_error("Out of Bounds: Calling setBefore()");
+  beforeCursor() = x;
+}
+
+// eraseAfter()
+// Deletes element after cursor.
+// pre: position()<length()
+void UnrolledList::eraseAfter() {
+  if (pos_cursor >= num_elements)
+    throw std::domain_error("Out of Bounds: Calling eraseAfter()");
+  eraseAtCursor();
+}
+
+// eraseBefore()
+// Deletes element before cursor.
+// pre: position()>0
+void UnrolledList::eraseBefore() {
+  if (pos_cursor <= 0)
+    throw std::domain_error("Out of Bounds: Calling eraseBefore()");
+  if (cursorIndex == 0) {
+    cursorBlock = cursorBlock->prev;
+    cursorIndex = cursorBlock->count;
+  }
+  cursorIndex--;
+  pos_cursor--;
+  eraseAtCursor();
+}
+
+// Other Functions ---------------------------------------------------------
+
+// findNext()
+// Starting from the current cursor position, performs a linear search (in
+// the direction front-to-back) for the first occurrence of element x. If x
+// is found, places the cursor immediately after the found element, then
+// returns the final cursor position. If x is not found, places the cursor
+// at position length(), and returns -1.
+int UnrolledList::findNext(ListElement x) {
+  // pos is the position of element 0 of B
+  int pos = pos_cursor - cursorIndex;
+  for (Block* B = cursorBlock; B; pos += B->count, B = B->next) {
+    int from = B == cursorBlock ? cursorIndex : 0;
+    const ListElement* data = B->data + B->start + from;
+    int i = from + static_cast<int>(
+                       findFirstN(data, B->count - from, x, searchLevel()));
+    if (i < B->count) {
+      cursorBlock = B;
+      cursorIndex = i + 1;
+      pos_cursor = pos + i + 1;
+      normalize();
+      return pos_cursor;
+    }
+  }
+  moveBack();
+  return -1;
+}
+
+// findPrev()
+// Starting from the current cursor position, performs a linear search (in
+// the direction back-to-front) for the first occurrence of element x. If x
+// is found, places the cursor immediately before the found element, then
+// returns the final cursor position. If x is not found, places the cursor
+// at position 0, and returns -1.
+int UnrolledList::findPrev(ListElement x) {
+  // end is the position just after the last element of B
+  int end = pos_cursor - (cursorBlock ? cursorIndex - cursorBlock->count : 0);
+  for (Block* B = cursorBlock; B; B = B->prev) {
+    int to = B == cursorBlock ? cursorIndex : B->count;
+    int i = static_cast<int>(
+        findLastN(B->data + B->start, to, x, searchLevel()));
+    if (i < to) {
+      cursorBlock = B;
+      cursorIndex = i;
+      pos_cursor = end - B->count + i;
+      return pos_cursor;
+    }
+    end -= B->count;
+  }
+  moveFront();
+  return -1;
+}
+
+// cleanup()
+// Removes any repeated elements in this List, leaving only unique elements.
+// The order of the remaining elements is obtained by retaining the frontmost
+// occurrance of each element, and removing all other occurances. The cursor
+// is not moved with respect to the retained elements, i.e. it lies between
+// the same two retained elements that it did before cleanup() was called.
+void UnrolledList::cleanup() {
+  std::vector<ListElement> kept;
+  std::unordered_set<ListElement> seen;
+  int index = 0;
+  int new_pos = 0;
+  for (Block* B = head; B; B = B->next) {
+    for (int i = 0; i < B->count; i++, index++) {
+      if (seen.insert(B->data[B->start + i]).second) {
+        kept.push_back(B->data[B->start + i]);
+        if (index < pos_cursor) new_pos++;
+      }
+    }
+  }
+  rebuild(kept, new_pos);
+}
+
+// concat()
+// Returns a new List consisting of the elements of this List, followed by
+// the elements of L. The cursor in the returned List will be at postion 0.
+UnrolledList UnrolledList::concat(const UnrolledList& L) const {
+  UnrolledList c;
+  for (Block* B = head; B; B = B->next) {
+    for (int i = 0; i < B->count; i++) c.pushBack(B->data[B->start + i]);
+  }
+  for (Block* B = L.head; B; B = B->next) {
+    for (int i = 0; i < B->count; i++) c.pushBack(B->data[B->start + i]);
+  }
+  c.seek(0);
+  return c;
+}
+
+// to_string()
+// Returns a string representation of this List consisting of a comma
+// separated sequence of elements, surrounded by parentheses.
+std::string UnrolledList::to_string() const {
+  std::string str = "(";
+  for (Block* B = head; B; B = B->next) {
+    for (int i = 0; i < B->count; i++) {
+      if (str.size() > 1) str += ", ";
+      str += std::to_string(B->data[B->start + i]);
+    }
+  }
+  str += ")";
+  return str;
+}
+
+// equals()
+// Returns true if and only if this List is the same integer sequence as R.
+// The cursors in this List and in R are unchanged.
+bool UnrolledList::equals(const UnrolledList& R) const {
+  if (length() != R.length()) return false;
+  // the two Lists may split their elements into blocks differently
+  Block* other = R.head;
+  int j = 0;
+  for (Block* B = head; B; B = B->next) {
+    for (int i = 0; i < B->count; i++, j++) {
+      if (j == other->count) {
+        other = other->next;
+        j = 0;
+      }
+      if (B->data[B->start + i] != other->data[other->start + j]) return false;
+    }
+  }
+  return true;
+}
+
+// Overriden Operators -----------------------------------------------------
+
+// operator<<()
+// Inserts string representation of L into stream.
+std::ostream& operator<<(std::ostream& stream, const UnrolledList& L) {
+  return stream << L.to_string();
+}
+
+// operator==()
+// Returns true if and only if A is the same integer sequence as B. The
+// cursors in both Lists are unchanged.
+bool operator==(const UnrolledList& A, const UnrolledList& B) {
+  return A.equals(B);
+}
+
+// operator=()
+// Overwrites the state of this List with state of L.
+UnrolledList& UnrolledList::operator=(const UnrolledList& L) {
+  if (this != &L) {
+    UnrolledList temp = L;
+    std::swap(head, temp.head);
+    std::swap(tail, temp.tail);
+    std::swap(cursorBlock, temp.cursorBlock);
+    std::swap(cursorIndex, temp.cursorIndex);
+    std::swap(pos_cursor, temp.pos_cursor);
+    std::swap(num_elements, temp.num_elements);
+  }
+  return *this;
+}
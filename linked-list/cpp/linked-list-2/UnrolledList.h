@@ -0,0 +1,259 @@
+/**
+ * @author Ethan Okamura
+ * @file UnrolledList.h
+ * @brief Header file for the unrolled List ADT, which keeps the List cursor
+ *        API but stores up to BLOCK_CAPACITY elements per node
+ * @status: working / tested
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef UNROLLED_LIST_H_INCLUDE_
+#define UNROLLED_LIST_H_INCLUDE_
+
+// Exported types -------------------------------------------------------------
+typedef int ListElement;
+
+// Elements per block. Inserting into a full block splits it in half, and
+// erasing merges neighbours that together fill at most half a block.
+const int BLOCK_CAPACITY = 64;
+
+class UnrolledList {
+ private:
+  // private Block struct
+  struct Block {
+    // Block fields
+    ListElement data[BLOCK_CAPACITY];  // elements in data[start, start+count)
+    int start;
+    int count;
+    Block* next;
+    Block* prev;
+    // Block constructor
+    Block();
+    // insert()
+    // Inserts x before element i, moving whichever side is shorter.
+    // pre: count < BLOCK_CAPACITY
+    void insert(int i, ListElement x);
+    // erase()
+    // Deletes element i, moving whichever side is shorter.
+    void erase(int i);
+  };
+
+  // UnrolledList fields
+  // The element after the cursor is element cursorIndex of cursorBlock. Only
+  // at position length() is cursorIndex == cursorBlock->count, in the tail
+  // block. No block is empty, and an empty list has no blocks.
+  Block* head;
+  Block* tail;
+  Block* cursorBlock;
+  int cursorIndex;
+  int pos_cursor;
+  int num_elements;
+
+  // Helpers -----------------------------------------------------------------
+
+  // linkBlock()
+  // Returns a new empty block linked in after B, or at the front if B is
+  // nullptr.
+  Block* linkBlock(Block* B);
+
+  // unlinkBlock()
+  // Unlinks and deletes B.
+  void unlinkBlock(Block* B);
+
+  // mergeNext()
+  // Moves the elements of B->next onto the end of B and deletes B->next.
+  // pre: B->count + B->next->count <= BLOCK_CAPACITY
+  void mergeNext(Block* B);
+
+  // normalize()
+  // Moves a cursor sitting past the last element of a block to the front of
+  // the next block.
+  void normalize();
+
+  // insertAtCursor()
+  // Inserts x after the cursor without moving it.
+  void insertAtCursor(ListElement x);
+
+  // eraseAtCursor()
+  // Deletes the element after the cursor without moving it, merging small
+  // neighbouring blocks.
+  // pre: position()<length()
+  void eraseAtCursor();
+
+  // pushBack()
+  // Appends x to the back, packing blocks full. Leaves the cursor alone.
+  void pushBack(ListElement x);
+
+  // beforeCursor()
+  // Returns the element before the cursor.
+  // pre: position()>0
+  ListElement& beforeCursor() const;
+
+  // seek()
+  // Places the cursor at position pos, walking from the nearer end.
+  // pre: 0 <= pos <= length()
+  void seek(int pos);
+
+  // rebuild()
+  // Replaces the elements with E, packed into full blocks, and places the
+  // cursor at position pos.
+  void rebuild(const std::vector<ListElement>& E, int pos);
+
+ public:
+  // Class Constructors & Destructors ----------------------------------------
+
+  // Creates new UnrolledList in the empty state.
+  UnrolledList();
+
+  // Copy constructor.
+  UnrolledList(const UnrolledList& L);
+
+  // Destructor
+  ~UnrolledList();
+
+  // Access functions --------------------------------------------------------
+
+  // length()
+  // Returns the length of this List.
+  int length() const;
+
+  // front()
+  // Returns the front element in this List.
+  // pre: length()>0
+  ListElement front() const;
+
+  // back()
+  // Returns the back element in this List.
+  // pre: length()>0
+  ListElement back() const;
+
+  // position()
+  // Returns the position of cursor in this List: 0 <= position() <= length().
+  int position() const;
+
+  // peekNext()
+  // Returns the element after the cursor.
+  // pre: position()<length()
+  ListElement peekNext() const;
+
+  // peekPrev()
+  // Returns the element before the cursor.
+  // pre: position()>0
+  ListElement peekPrev() const;
+
+  // Manipulation procedures -------------------------------------------------
+
+  // clear()
+  // Deletes all elements in this List, setting it to the empty state.
+  void clear();
+
+  // moveFront()
+  // Moves cursor to position 0 in this List.
+  void moveFront();
+
+  // moveBack()
+  // Moves cursor to position length() in this List.
+  void moveBack();
+
+  // moveNext()
+  // Advances cursor to next higher position. Returns the List element that
+  // was passed over.
+  // pre: position()<length()
+  ListElement moveNext();
+
+  // movePrev()
+  // Advances cursor to next lower position. Returns the List element that
+  // was passed over.
+  // pre: position()>0
+  ListElement movePrev();
+
+  // insertAfter()
+  // Inserts x after cursor.
+  void insertAfter(ListElement x);
+
+  // insertBefore()
+  // Inserts x before cursor.
+  void insertBefore(ListElement x);
+
+  // setAfter()
+  // Overwrites the List element after the cursor with x.
+  // pre: position()<length()
+  void setAfter(ListElement x);
+
+  // setBefore()
+  // Overwrites the List element before the cursor with x.
+  // pre: position()>0
+  void setBefore(ListElement x);
+
+  // eraseAfter()
+  // Deletes element after cursor.
+  // pre: position()<length()
+  void eraseAfter();
+
+  // eraseBefore()
+  // Deletes element before cursor.
+  // pre: position()>0
+  void eraseBefore();
+
+  // Other Functions ---------------------------------------------------------
+
+  // findNext()
+  // Starting from the current cursor position, performs a linear search (in
+  // the direction front-to-back) for the first occurrence of element x. If x
+  // is found, places the cursor immediately after the found element, then
+  // returns the final cursor position. If x is not found, places the cursor
+  // at position length(), and returns -1.
+  int findNext(ListElement x);
+
+  // findPrev()
+  // Starting from the current cursor position, performs a linear search (in
+  // the direction back-to-front) for the first occurrence of element x. If x
+  // is found, places the cursor immediately before the found element, then
+  // returns the final cursor position. If x is not found, places the cursor
+  // at position 0, and returns -1.
+  int findPrev(ListElement x);
+
+  // cleanup()
+  // Removes any repeated elements in this List, leaving only unique elements.
+  // The order of the remaining elements is obtained by retaining the frontmost
+  // occurrance of each element, and removing all other occurances. The cursor
+  // is not moved with respect to the retained elements, i.e. it lies between
+  // the same two retained elements that it did before cleanup() was called.
+  void cleanup();
+
+  // concat()
+  // Returns a new List consisting of the elements of this List, followed by
+  // the elements of L. The cursor in the returned List will be at postion 0.
+  UnrolledList concat(const UnrolledList& L) const;
+
+  // to_string()
+  // Returns a string representation of this List consisting of a comma
+  // separated sequence of elements, surrounded by parentheses.
+  std::string to_string() const;
+
+  // equals()
+  // Returns true if and only if this List is the same integer sequence as R.
+  // The cursors in this List and in R are unchanged.
+  bool equals(const UnrolledList& R) const;
+
+  // Overriden Operators -----------------------------------------------------
+
+  // operator<<()
+  // Inserts string representation of L into stream.
+  friend std::ostream& operator<<(std::ostream& stream,
+                                  const UnrolledList& L);
+
+  // operator==()
+  // Returns true if and only if A is the same integer sequence as B. The
+  // cursors in both Lists are unchanged.
+  friend bool operator==(const UnrolledList& A, const UnrolledList& B);
+
+  // operator=()
+  // Overwrites the state of this List with state of L.
+  UnrolledList& operator=(const UnrolledList& L);
+};
+
+#endif
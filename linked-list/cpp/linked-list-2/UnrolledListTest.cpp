@@ -0,0 +1,228 @@
+/**
+ * @author Ethan Okamura
+ * @file UnrolledListTest.cpp
+ * @brief Main testing file for the unrolled List ADT
+ * @status: working / tested
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../simd/FindKernels.h"
+#include "UnrolledList.h"
+
+using std::cout;
+using std::endl;
+
+// Builds the list (1, 2, ..., n) with the cursor at the back.
+UnrolledList makeRange(int n) {
+  UnrolledList L;
+  for (int i = 1; i <= n; i++) L.insertBefore(i);
+  return L;
+}
+
+void testEmptyList() {
+  cout << "=== Test Empty List ===" << endl;
+  UnrolledList L;
+  assert(L.length() == 0);
+  assert(L.position() == 0);
+  try {
+    L.front();
+    assert(false && "front() should throw on empty list");
+  } catch (std::logic_error &) {
+  }
+  try {
+    L.peekNext();
+    assert(false && "peekNext() should throw on empty list");
+  } catch (std::domain_error &) {
+  }
+  assert(L.findNext(1) == -1 && L.findPrev(1) == -1);
+  assert(L.to_string() == "()");
+  cout << "Empty list tests passed." << endl << endl;
+}
+
+void testBlockBoundaries() {
+  cout << "=== Test Block Boundaries ===" << endl;
+  const int n = 5 * BLOCK_CAPACITY + 3;
+  UnrolledList L = makeRange(n);
+  assert(L.length() == n && L.position() == n);
+  assert(L.front() == 1 && L.back() == n);
+
+  // walk forward and back across every block boundary
+  L.moveFront();
+  for (int i = 1; i <= n; i++) assert(L.moveNext() == i);
+  for (int i = n; i >= 1; i--) assert(L.movePrev() == i);
+
+  // split a full block in the middle, then erase back down to one block
+  L.moveFront();
+  for (int i = 0; i < BLOCK_CAPACITY / 2; i++) L.moveNext();
+  L.insertAfter(-1);
+  L.insertBefore(-2);
+  assert(L.peekNext() == -1 && L.peekPrev() == -2);
+  assert(L.length() == n + 2);
+  L.eraseBefore();
+  L.eraseAfter();
+  assert(L == makeRange(n));
+  L.moveBack();
+  while (L.length() > 1) L.eraseBefore();
+  assert(L.to_string() == "(1)");
+  cout << "Block boundary tests passed." << endl << endl;
+}
+
+void testFindAndCleanup() {
+  cout << "=== Test findNext, findPrev, and cleanup ===" << endl;
+  UnrolledList L;
+  for (int i = 0; i < 4 * BLOCK_CAPACITY; i++) L.insertBefore(i % 10);
+  L.moveFront();
+  assert(L.findNext(9) == 10);
+  assert(L.findNext(9) == 20);
+  assert(L.findPrev(0) == 10);
+  assert(L.findNext(42) == -1 && L.position() == L.length());
+  assert(L.findPrev(0) == L.length() - 6);
+  assert(L.findPrev(42) == -1 && L.position() == 0);
+
+  // cursor between the 3rd and 4th elements stays between 2 and 3
+  L.moveFront();
+  for (int i = 0; i < 3; i++) L.moveNext();
+  L.cleanup();
+  assert(L.to_string() == "(0, 1, 2, 3, 4, 5, 6, 7, 8, 9)");
+  assert(L.position() == 3 && L.peekNext() == 3);
+  cout << "findNext/findPrev/cleanup tests passed." << endl << endl;
+}
+
+void testConcatAndCopy() {
+  cout << "=== Test concat, copy constructor, and assignment operator ==="
+       << endl;
+  UnrolledList L1 = makeRange(BLOCK_CAPACITY + 1);
+  UnrolledList L2 = makeRange(3);
+  UnrolledList L3 = L1.concat(L2);
+  assert(L3.length() == BLOCK_CAPACITY + 4 && L3.position() == 0);
+  assert(L3.back() == 3);
+
+  UnrolledList L4 = L3;
+  assert(L4 == L3 && L4.position() == L4.length());
+  UnrolledList L5;
+  L5 = L3;
+  assert(L5 == L3);
+  L5.moveFront();
+  L5.setAfter(0);
+  assert(!(L5 == L3));
+  cout << "Copy and assignment tests passed." << endl << endl;
+}
+
+// Applies random cursor operations to an UnrolledList and to a vector with
+// an index cursor, checking that both hold the same sequence throughout.
+void testAgainstVector() {
+  cout << "=== Test random operations against a vector ===" << endl;
+  std::mt19937 rng(7);
+  UnrolledList L;
+  std::vector<int> V;
+  size_t cursor = 0;
+  for (int step = 0; step < 200000; step++) {
+    int x = static_cast<int>(rng() % 50);
+    bool grow = V.size() < 600;
+    switch (rng() % 10) {
+      case 0:
+      case 1:
+        if (grow) {
+          L.insertAfter(x);
+          V.insert(V.begin() + cursor, x);
+        }
+        break;
+      case 2:
+      case 3:
+        if (grow) {
+          L.insertBefore(x);
+          V.insert(V.begin() + cursor++, x);
+        }
+        break;
+      case 4:
+        if (cursor < V.size()) {
+          L.eraseAfter();
+          V.erase(V.begin() + cursor);
+        }
+        break;
+      case 5:
+        if (cursor > 0) {
+          L.eraseBefore();
+          V.erase(V.begin() + --cursor);
+        }
+        break;
+      case 6:
+        if (cursor < V.size()) assert(L.moveNext() == V[cursor++]);
+        break;
+      case 7:
+        if (cursor > 0) assert(L.movePrev() == V[--cursor]);
+        break;
+      case 8:
+        if (rng() % 2) {
+          auto it = std::find(V.begin() + cursor, V.end(), x);
+          cursor = it == V.end() ? V.size() : it - V.begin() + 1;
+          int expected = it == V.end() ? -1 : static_cast<int>(cursor);
+          assert(L.findNext(x) == expected);
+        } else {
+          auto it = std::find(V.rbegin() + (V.size() - cursor), V.rend(), x);
+          cursor = it == V.rend() ? 0 : V.rend() - it - 1;
+          int expected = it == V.rend() ? -1 : static_cast<int>(cursor);
+          assert(L.findPrev(x) == expected);
+        }
+        break;
+      default:
+        if (cursor < V.size()) {
+          L.setAfter(x);
+          V[cursor] = x;
+        }
+        if (cursor > 0) {
+          L.setBefore(x + 1);
+          V[cursor - 1] = x + 1;
+        }
+        break;
+    }
+    assert(L.length() == static_cast<int>(V.size()));
+    assert(L.position() == static_cast<int>(cursor));
+    if (cursor < V.size()) assert(L.peekNext() == V[cursor]);
+    if (cursor > 0) assert(L.peekPrev() == V[cursor - 1]);
+  }
+  UnrolledList R;
+  for (int x : V) R.insertBefore(x);
+  assert(L == R);
+  cout << "Random operation tests passed." << endl << endl;
+}
+
+// Checks the int search kernels behind findNext() and findPrev() against
+// the scalar ones at every SimdLevel this CPU supports, on arrays of every
+// length up to two vector steps past a block, including negative keys.
+void testSearchKernels() {
+  cout << "=== Test Search Kernels ===" << endl;
+  std::mt19937 rng(7);
+  SimdLevel detected = detectSimdLevel();
+  for (int trial = 0; trial < 2000; trial++) {
+    size_t n = trial % (BLOCK_CAPACITY + 33);
+    // few distinct values, so keys repeat or are missing
+    std::vector<int> A(n);
+    for (int& a : A) a = static_cast<int>(rng() % 6) - 2;
+    int key = static_cast<int>(rng() % 6) - 2;
+    size_t first = findFirstScalar(A.data(), n, key);
+    size_t last = findLastScalar(A.data(), n, key);
+    for (int level = 0; level <= static_cast<int>(detected); level++) {
+      SimdLevel L = static_cast<SimdLevel>(level);
+      assert(findFirstN(A.data(), n, key, L) == first);
+      assert(findLastN(A.data(), n, key, L) == last);
+    }
+  }
+  cout << "Search kernel tests passed." << endl << endl;
+}
+
+int main() {
+  testEmptyList();
+  testBlockBoundaries();
+  testFindAndCleanup();
+  testConcatAndCopy();
+  testAgainstVector();
+  testSearchKernels();
+  cout << "All tests passed." << endl;
+  return 0;
+}
@@ -0,0 +1,64 @@
+/**
+ * @author Ethan Okamura
+ * @file benchmark.cpp
+ * @brief times push/pop cycles at the back of a LinkedList of large strings
+ *        by copy, by move and by emplace
+ */
+
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <utility>
+
+#include "linked_list.h"
+
+// returns the seconds taken by cycles calls of cycle(list)
+// the list holds length payload-sized strings throughout
+template <typename Cycle>
+double time_cycles(const char *name, int cycles, std::size_t length,
+                   std::size_t payload, Cycle cycle) {
+  LinkedList<std::string> list;
+  for (std::size_t i = 0; i < length; i++) list.emplace_back(payload, 'x');
+  std::clock_t time = std::clock();  // start
+  for (int i = 0; i < cycles; i++) cycle(list);
+  time = std::clock() - time;  // stop
+  if (list.size() != length || list.back().size() != payload) {
+    std::cerr << "benchmark: " << name << " changed the list\n";
+    std::exit(EXIT_FAILURE);
+  }
+  double seconds = static_cast<double>(time) / CLOCKS_PER_SEC;
+  std::cout << name << ": " << seconds << " s\n";
+  return seconds;
+}
+
+// usage: benchmark [cycles] [list length] [payload bytes]
+int main(int argc, char **argv) {
+  int cycles = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  std::size_t length = argc > 2 ? std::atoi(argv[2]) : 1000;
+  std::size_t payload = argc > 3 ? std::atoi(argv[3]) : 4096;
+  std::cout << "--- " << cycles << " push_back/pop_back cycles, " << length
+            << " strings of " << payload << " bytes ---\n";
+
+  const std::string value(payload, 'x');
+  double copy = time_cycles("push_back copy", cycles, length, payload,
+                            [&](LinkedList<std::string> &list) {
+                              list.push_back(value);
+                              list.pop_back();
+                            });
+  time_cycles("emplace_back", cycles, length, payload,
+              [&](LinkedList<std::string> &list) {
+                list.emplace_back(payload, 'x');
+                list.pop_back();
+              });
+  // one string moves in and out, so nothing is allocated after the first
+  std::string moving = value;
+  double move = time_cycles("push_back move", cycles, length, payload,
+                            [&](LinkedList<std::string> &list) {
+                              list.push_back(std::move(moving));
+                              moving = std::move(list.back());
+                              list.pop_back();
+                            });
+  std::cout << "move is " << copy / move << "x faster than copy\n";
+  return EXIT_SUCCESS;
+}
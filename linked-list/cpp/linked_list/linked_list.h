@@ -7,14 +7,65 @@
  * @brief creates a simple linked list!
  */
 
+#include <algorithm>
+#include <cstddef>
 #include <initializer_list>
 #include <iostream>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <utility>
 
 // Defines a doubly-linked list
+// each node links to both neighbours, so both ends push and pop in O(1)
 template <typename T>
 class LinkedList {
   struct Node;  // forward declaration for our private Node type
  public:
+  // forward iterator over the elements, from head to one past the tail
+  // Value is T for iterator and const T for const_iterator
+  template <typename Value>
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value *;
+    using reference = Value &;
+
+    Iterator() : node(nullptr) {}
+    // an iterator converts to a const_iterator
+    operator Iterator<const T>() const { return Iterator<const T>(node); }
+
+    reference operator*() const { return node->data; }
+    pointer operator->() const { return &node->data; }
+
+    Iterator &operator++() {
+      node = node->next;
+      return *this;
+    }
+    Iterator operator++(int) {
+      Iterator old = *this;
+      node = node->next;
+      return old;
+    }
+
+    friend bool operator==(const Iterator &a, const Iterator &b) {
+      return a.node == b.node;
+    }
+    friend bool operator!=(const Iterator &a, const Iterator &b) {
+      return a.node != b.node;
+    }
+
+   private:
+    friend class LinkedList;
+    friend class Iterator<T>;
+    explicit Iterator(Node *node) : node(node) {}
+    Node *node;
+  };
+  using iterator = Iterator<T>;
+  using const_iterator = Iterator<const T>;
+
   // default constructor
   LinkedList() : head(nullptr), tail(nullptr), list_size(0) {}
 
@@ -25,25 +76,30 @@ class LinkedList {
 
   // copy constructor
   LinkedList(const LinkedList<T> &another) {
-    for (Node *current = another.head; current; current = current->next)
-      push_back(current->data);
+    for (const T &val : another) push_back(val);
   }
 
+  // move constructor
+  // takes over the nodes and pool of another, leaving it empty
+  LinkedList(LinkedList<T> &&another) noexcept { swap_state(another); }
+
   // destructor
   ~LinkedList() {
-    Node *current = head;
-    while (current) {
-      Node *next = current->next;
-      delete current;
-      current = next;
+    clear();
+    while (blocks) {
+      Slot *next = blocks->next_free;
+      delete[] blocks;
+      blocks = next;
     }
   }
 
-  // return head for iteration
-  Node *begin() const { return head; }
-
-  // return tail for iteration
-  Node *end() const { return tail; }
+  // iterators to the head and to one past the tail
+  iterator begin() { return iterator(head); }
+  iterator end() { return iterator(nullptr); }
+  const_iterator begin() const { return const_iterator(head); }
+  const_iterator end() const { return const_iterator(nullptr); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
 
   // returns the value of the head node
   T &front() const {
@@ -65,63 +121,63 @@ class LinkedList {
 
   // adds a new element (val)
   // assigns new element as head
-  void push_front(T val) {
-    Node *new_node = new Node(val);
+  void push_front(const T &val) { emplace_front(val); }
+  void push_front(T &&val) { emplace_front(std::move(val)); }
+
+  // adds a new element (val)
+  // assigns new element as tail
+  void push_back(const T &val) { emplace_back(val); }
+  void push_back(T &&val) { emplace_back(std::move(val)); }
+
+  // constructs a new head element in place from args
+  template <typename... Args>
+  T &emplace_front(Args &&...args) {
+    Node *new_node = make_node(std::forward<Args>(args)...);
     if (empty()) {
       head = tail = new_node;
     } else {
       new_node->next = head;
+      head->prev = new_node;
       head = new_node;
     }
     list_size++;
+    return new_node->data;
   }
 
-  // adds a new element (val)
-  // assigns new element as tail
-  void push_back(T val) {
-    Node *new_node = new Node(val);
+  // constructs a new tail element in place from args
+  template <typename... Args>
+  T &emplace_back(Args &&...args) {
+    Node *new_node = make_node(std::forward<Args>(args)...);
     if (empty()) {
       head = tail = new_node;
     } else {
+      new_node->prev = tail;
       tail->next = new_node;
       tail = new_node;
     }
     list_size++;
+    return new_node->data;
   }
 
   // removes the current head node from list
   // reassigns new head
   void pop_front() {
     if (empty()) throw std::domain_error("empty list!");
-    Node *temp = head;
-    head = head->next;
-    delete temp;
-    if (!head) tail = nullptr;
-    list_size--;
+    unlink(head);
   }
 
-  // removes the current head node from list
-  // reassigns new head
+  // removes the current tail node from list
+  // reassigns new tail in O(1) through its prev link
   void pop_back() {
     if (empty()) throw std::domain_error("empty list!");
-    if (!head->next) {
-      delete head;
-      head = tail = nullptr;
-      list_size--;
-      return;
-    }
-    Node *current = head;
-    while (current->next->next) current = current->next;
-    delete current->next;
-    current->next = nullptr;
-    tail = current;
-    list_size--;
+    unlink(tail);
   }
 
   // resizes the list
+  // new elements are value-initialized (0 for numbers)
   void resize(std::size_t n) {
     if (list_size == n) return;
-    while (list_size < n) push_back(0);
+    while (list_size < n) emplace_back();
     while (list_size > n) pop_back();
   }
 
@@ -133,74 +189,39 @@ class LinkedList {
   }
 
   // clears the linked list
+  // the nodes stay in this list's pool for later pushes
   void clear() {
     while (head) pop_front();
   }
 
   // removes the first value in the list that matches the target value
   void remove(const T &target) {
-    if (empty()) return;
-    if (head->data == target) {
-      pop_front();
-      return;
-    }
     Node *current = head;
-    while (current->next && current->next->data != target)
-      current = current->next;
-    if (current->next) {
-      Node *temp = current->next;
-      current->next = current->next->next;
-      list_size--;
-      delete temp;
-    }
+    while (current && current->data != target) current = current->next;
+    if (current) unlink(current);
   }
 
   // function to remove all occurrences of a value from the linked list
   void remove_all(const T &target) {
     Node *current = head;
-    Node *prev = nullptr;
     while (current) {
-      if (current->data == target) {
-        Node *temp = current;
-        if (!prev)
-          head = current->next;
-        else
-          prev->next = current->next;
-        current = current->next;
-        delete temp;
-        list_size--;
-      } else {
-        prev = current;
-        current = current->next;
-      }
+      Node *next = current->next;
+      if (current->data == target) unlink(current);
+      current = next;
     }
-    if (prev) tail = prev;
   }
 
   // reverse the order of elements
+  // swaps the links of every node, then the ends
   void reverse() {
-    Node *prev = nullptr;
-    Node *cur = head;
-    Node *next = nullptr;
-    while (cur) {
-      next = cur->next;
-      cur->next = prev;
-      prev = cur;
-      cur = next;
-    }
-    Node *temp = head;
-    head = prev;
-    tail = temp;
+    for (Node *cur = head; cur; cur = cur->prev)
+      std::swap(cur->next, cur->prev);
+    std::swap(head, tail);
   }
 
   // check if a value exists in the linked list
   bool contains(const T &target) const {
-    Node *current = head;
-    while (current) {
-      if (current->data == target) return true;
-      current = current->next;
-    }
-    return false;
+    return std::find(begin(), end(), target) != end();
   }
 
   // assigns list to a new list
@@ -212,26 +233,23 @@ class LinkedList {
 
   // assigns list to an existing list
   LinkedList &operator=(const LinkedList &another) {
-    Node *current = another.head;
+    if (this == &another) return *this;
     clear();
-    while (current) {
-      push_back(current->data);
-      current = current->next;
-    }
+    for (const T &val : another) push_back(val);
+    return *this;
+  }
+
+  // moves another into this list
+  // the old nodes of this list go to another, which frees them
+  LinkedList &operator=(LinkedList &&another) noexcept {
+    if (this != &another) swap_state(another);
     return *this;
   }
 
   // checks list for equivalency to another list
   bool operator==(const LinkedList &another) {
-    if (size() != another.size()) return false;
-    Node *current = head;
-    Node *other = another.head;
-    while (current) {
-      if (other->data != current->data) return false;
-      current = current->next;
-      other = other->next;
-    }
-    return true;
+    return size() == another.size() &&
+           std::equal(begin(), end(), another.begin());
   }
 
   // checks list for inequivalency to another list
@@ -247,14 +265,10 @@ class LinkedList {
 
   // allows stdout of list
   friend std::ostream &operator<<(std::ostream &out, const LinkedList &list) {
-    Node *current = list.head;
-    int index = 0;
     out << '[';
-    while (current) {
-      out << current->data;
-      if (index < list.size() - 1) out << ", ";
-      index++;
-      current = current->next;
+    for (const_iterator it = list.begin(); it != list.end(); ++it) {
+      if (it != list.begin()) out << ", ";
+      out << *it;
     }
     out << ']';
     return out;
@@ -264,11 +278,77 @@ class LinkedList {
   struct Node {
     T data;
     Node *next = nullptr;
-    Node(T value) : data(value), next(nullptr) {}
+    Node *prev = nullptr;
+    // builds data in place from args
+    template <typename... Args>
+    explicit Node(Args &&...args)
+        : data(std::forward<Args>(args)...), next(nullptr), prev(nullptr) {}
   };
   Node *head = nullptr;
   Node *tail = nullptr;
   std::size_t list_size = 0;
+
+  // node pool: storage for one node, linked into the free list while unused
+  union Slot {
+    Slot *next_free;
+    alignas(Node) unsigned char storage[sizeof(Node)];
+  };
+  // nodes in the first and largest pool blocks
+  static constexpr std::size_t MIN_BLOCK = 8, MAX_BLOCK = 1024;
+  Slot *free_slots = nullptr;
+  Slot *blocks = nullptr;  // slot 0 of each block links to the previous block
+  std::size_t block_size = MIN_BLOCK;
+
+  // builds a node holding T(args...) in a free slot
+  // refills the free list with a new block, twice as big, when it is empty
+  template <typename... Args>
+  Node *make_node(Args &&...args) {
+    if (!free_slots) {
+      Slot *block = new Slot[block_size + 1];
+      block[0].next_free = blocks;
+      blocks = block;
+      for (std::size_t i = 1; i <= block_size; i++) {
+        block[i].next_free = free_slots;
+        free_slots = &block[i];
+      }
+      block_size = std::min(2 * block_size, MAX_BLOCK);
+    }
+    Slot *slot = free_slots;
+    free_slots = slot->next_free;
+    try {
+      return new (slot->storage) Node(std::forward<Args>(args)...);
+    } catch (...) {
+      slot->next_free = free_slots;
+      free_slots = slot;
+      throw;
+    }
+  }
+
+  // destroys node and returns its slot to the free list
+  void free_node(Node *node) {
+    node->~Node();
+    Slot *slot = reinterpret_cast<Slot *>(node);
+    slot->next_free = free_slots;
+    free_slots = slot;
+  }
+
+  // links node out of the list and frees it
+  void unlink(Node *node) {
+    (node->prev ? node->prev->next : head) = node->next;
+    (node->next ? node->next->prev : tail) = node->prev;
+    free_node(node);
+    list_size--;
+  }
+
+  // exchanges the nodes and pools of this list and another
+  void swap_state(LinkedList &another) noexcept {
+    std::swap(head, another.head);
+    std::swap(tail, another.tail);
+    std::swap(list_size, another.list_size);
+    std::swap(free_slots, another.free_slots);
+    std::swap(blocks, another.blocks);
+    std::swap(block_size, another.block_size);
+  }
 };
 
 #endif  // LINKED_LIST_H
@@ -1,4 +1,7 @@
+#include <algorithm>
 #include <iostream>
+#include <sstream>
+#include <string>
 
 #include "linked_list.h"
 
@@ -132,5 +135,96 @@ int main() {
     std::cout << "Failed" << std::endl;
   }
 
+  // Test reuse of pooled nodes after clear
+  LinkedList<std::string> list8;
+  for (int round = 0; round < 3; round++) {
+    list8.clear();
+    for (int i = 0; i < 100; i++) list8.push_front(std::to_string(i));
+  }
+  std::cout << "Test reuse after clear: ";
+  if (list8.size() == 100 && list8.front() == "99" && list8.back() == "0") {
+    std::cout << "Passed" << std::endl;
+  } else {
+    std::cout << "Failed" << std::endl;
+  }
+
+  // Test emplace_front and emplace_back
+  LinkedList<std::string> list9;
+  list9.emplace_back(3, 'b');
+  list9.emplace_front("a");
+  std::string &c = list9.emplace_back("c");
+  std::cout << "Test emplace: ";
+  if (list9.size() == 3 && list9.front() == "a" && list9[1] == "bbb" &&
+      &c == &list9.back()) {
+    std::cout << "Passed" << std::endl;
+  } else {
+    std::cout << "Failed" << std::endl;
+  }
+
+  // Test pop_back walks the prev links
+  LinkedList<int> list10 = {1, 2, 3, 4};
+  list10.reverse();
+  list10.pop_back();
+  list10.pop_back();
+  list10.push_back(5);
+  std::cout << "Test pop_back after reverse: ";
+  LinkedList<int> expected10 = {4, 3, 5};
+  if (list10 == expected10) {
+    std::cout << "Passed" << std::endl;
+  } else {
+    std::cout << "Failed" << std::endl;
+  }
+
+  // Test remove_all of every element, then push_back
+  LinkedList<int> list11 = {2, 2, 2};
+  list11.remove_all(2);
+  list11.push_back(7);
+  list11.remove(7);
+  list11.push_back(8);
+  std::cout << "Test remove_all of every element: ";
+  if (list11.size() == 1 && list11.front() == 8 && list11.back() == 8) {
+    std::cout << "Passed" << std::endl;
+  } else {
+    std::cout << "Failed" << std::endl;
+  }
+
+  // Test move constructor and move assignment
+  std::string payload(1000, 'x');
+  LinkedList<std::string> list12;
+  list12.push_back(std::move(payload));
+  LinkedList<std::string> list13(std::move(list12));
+  LinkedList<std::string> list14 = {"old"};
+  list14 = std::move(list13);
+  list12.push_back("reused");
+  std::cout << "Test move operations: ";
+  if (list12.front() == "reused" && list14.size() == 1 &&
+      list14.front().size() == 1000) {
+    std::cout << "Passed" << std::endl;
+  } else {
+    std::cout << "Failed" << std::endl;
+  }
+
+  // Test iterators with range-for and <algorithm>
+  LinkedList<int> list15 = {4, 1, 3};
+  int sum = 0;
+  for (int &val : list15) val *= 2;
+  for (int val : list15) sum += val;
+  const LinkedList<int> &const15 = list15;
+  LinkedList<int>::const_iterator found =
+      std::find(const15.begin(), const15.end(), 6);
+  LinkedList<int>::iterator max =
+      std::max_element(list15.begin(), list15.end());
+  std::ostringstream printed;
+  printed << list15;
+  std::cout << "Test iterators: ";
+  if (sum == 16 && found != const15.end() && *found == 6 &&
+      max == list15.begin() && max == const15.begin() &&
+      std::distance(list15.cbegin(), list15.cend()) == 3 &&
+      printed.str() == "[8, 2, 6]") {
+    std::cout << "Passed" << std::endl;
+  } else {
+    std::cout << "Failed" << std::endl;
+  }
+
   return 0;
 }
\ No newline at end of file
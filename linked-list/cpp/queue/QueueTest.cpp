@@ -0,0 +1,166 @@
+/**
+ * @author Ethan Okamura
+ * @file QueueTest.cpp
+ * @brief Main testing file for the ring buffer Queue and, single-threaded,
+ *        the exception safety of MpmcQueue
+ * @status: working / tested
+ */
+
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "mpmc_queue.h"
+#include "queue.h"
+
+using std::cout;
+using std::endl;
+
+// A long string, so it lives on the heap rather than in the string itself.
+std::string value(int i) {
+  return "value number " + std::to_string(i) + " of the queue under test";
+}
+
+// Copies throw once copies_left reaches zero. Its move constructor is not
+// noexcept, so a growing Queue copies it instead of moving it.
+struct Fragile {
+  static int copies_left;
+  static int alive;
+  int n;
+  explicit Fragile(int n) : n(n) { alive++; }
+  Fragile(const Fragile& another) : n(another.n) {
+    if (copies_left-- == 0) throw std::runtime_error("copy failed");
+    alive++;
+  }
+  Fragile(Fragile&& another) : n(another.n) { alive++; }
+  ~Fragile() { alive--; }
+};
+int Fragile::copies_left = -1;
+int Fragile::alive = 0;
+
+void testEmptyQueue() {
+  cout << "=== Test Empty Queue ===" << endl;
+  Queue<int> Q;
+  assert(Q.empty() && Q.size() == 0);
+  try {
+    Q.front();
+    assert(false && "front() should throw on an empty queue");
+  } catch (std::domain_error&) {
+  }
+  try {
+    Q.pop();
+    assert(false && "pop() should throw on an empty queue");
+  } catch (std::domain_error&) {
+  }
+  cout << "Empty queue tests passed." << endl << endl;
+}
+
+void testWrapAndGrow() {
+  cout << "=== Test Wrap And Grow ===" << endl;
+  Queue<std::string> Q;
+  int pushed = 0, popped = 0;
+  // keep the front moving so the values wrap before every growth
+  for (int round = 0; round < 200; round++) {
+    for (int i = 0; i < 3; i++) Q.push(value(pushed++));
+    assert(Q.front() == value(popped));
+    Q.pop();
+    popped++;
+    assert(Q.size() == pushed - popped);
+  }
+  Queue<std::string> copy(Q);
+  while (!Q.empty()) {
+    assert(Q.front() == value(popped++));
+    Q.pop();
+  }
+  assert(copy.size() == pushed - 200 && copy.front() == value(200));
+  cout << "Wrap and grow tests passed." << endl << endl;
+}
+
+void testSelfPush() {
+  cout << "=== Test Self Push ===" << endl;
+  // a full buffer, wrapped, so the push must grow while copying its front
+  Queue<std::string> Q;
+  for (int i = 0; i < 16; i++) Q.push(value(i));
+  for (int i = 16; i < 21; i++) {
+    Q.pop();
+    Q.push(value(i));
+  }
+  assert(Q.size() == 16);
+  Q.push(Q.front());
+  Q.emplace(Q.front(), 0, 5);
+  assert(Q.size() == 18);
+  for (int i = 5; i < 21; i++) {
+    assert(Q.front() == value(i));
+    Q.pop();
+  }
+  assert(Q.front() == value(5));
+  Q.pop();
+  assert(Q.front() == "value");
+  cout << "Self push tests passed." << endl << endl;
+}
+
+void testThrowingCopy() {
+  cout << "=== Test Throwing Copy ===" << endl;
+  {
+    Queue<Fragile> Q;
+    for (int i = 0; i < 16; i++) Q.emplace(i);
+    // growing copies the 16 values; the 10th copy throws
+    Fragile::copies_left = 9;
+    try {
+      Q.emplace(16);
+      assert(false && "emplace() should pass on the copy's exception");
+    } catch (std::runtime_error&) {
+    }
+    Fragile::copies_left = -1;
+    assert(Q.size() == 16 && Fragile::alive == 16);
+    for (int i = 0; i < 16; i++) {
+      assert(Q.front().n == i);
+      Q.pop();
+    }
+    // the same through reserve()
+    for (int i = 0; i < 16; i++) Q.emplace(i);
+    Fragile::copies_left = 3;
+    try {
+      Q.reserve(100);
+      assert(false && "reserve() should pass on the copy's exception");
+    } catch (std::runtime_error&) {
+    }
+    Fragile::copies_left = -1;
+    assert(Q.size() == 16 && Fragile::alive == 16 && Q.front().n == 0);
+  }
+  assert(Fragile::alive == 0);
+  cout << "Throwing copy tests passed." << endl << endl;
+}
+
+void testMpmcThrowingCopy() {
+  cout << "=== Test MpmcQueue Throwing Copy ===" << endl;
+  // a copy that throws must not leave a claimed cell unpublished
+  MpmcQueue<std::string> Q(4);
+  struct Bad {
+    operator std::string() const { throw std::runtime_error("no string"); }
+  };
+  try {
+    Q.try_emplace(Bad());
+    assert(false && "try_emplace() should pass on the exception");
+  } catch (std::runtime_error&) {
+  }
+  for (int i = 0; i < 4; i++) assert(Q.try_push(value(i)));
+  assert(!Q.try_push(value(4)));
+  std::string out;
+  for (int i = 0; i < 4; i++) {
+    assert(Q.try_pop(out) && out == value(i));
+  }
+  assert(!Q.try_pop(out));
+  cout << "MpmcQueue throwing copy tests passed." << endl << endl;
+}
+
+int main() {
+  testEmptyQueue();
+  testWrapAndGrow();
+  testSelfPush();
+  testThrowingCopy();
+  testMpmcThrowingCopy();
+  cout << "All tests passed." << endl;
+  return 0;
+}
@@ -0,0 +1,182 @@
+/**
+ * @author Ethan Okamura
+ * @file concurrent_benchmark.cpp
+ * @brief times the lock-free SpscQueue and MpmcQueue against a Queue behind
+ *        a mutex, sweeping the number of producer and consumer threads
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "mpmc_queue.h"
+#include "queue.h"
+#include "spsc_queue.h"
+
+using Clock = std::chrono::steady_clock;
+
+// a value passed between threads, stamped when it was pushed
+struct Item {
+  std::uint64_t value;
+  Clock::time_point pushed;
+};
+
+// a Queue behind one mutex, bounded like the lock-free queues
+template <typename T>
+class LockedQueue {
+ public:
+  explicit LockedQueue(std::size_t capacity) : limit(capacity) {
+    queue.reserve(capacity);
+  }
+  bool try_push(const T &val) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (static_cast<std::size_t>(queue.size()) == limit) return false;
+    queue.push(val);
+    return true;
+  }
+  bool try_pop(T &out) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (queue.empty()) return false;
+    out = queue.front();
+    queue.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex;
+  Queue<T> queue;
+  std::size_t limit;
+};
+
+// what one run measured
+struct Result {
+  double seconds;
+  std::vector<double> latencies;  // sampled push-to-pop times in us
+};
+
+// pushes the values 0 .. items - 1 through queue, split over producers and
+// consumers threads, checks that each came out exactly once, and returns
+// the elapsed time and every 64th push-to-pop latency
+template <typename QueueType>
+Result run(QueueType &queue, int producers, int consumers, long items) {
+  std::atomic<int> ready(0);
+  std::atomic<bool> go(false);
+  std::atomic<long> popped(0);
+  std::atomic<bool> stray(false);  // a value outside 0 .. items - 1 came out
+  // how many times each value came out; a sum alone would let a lost value
+  // and a repeated one cancel out
+  std::vector<std::atomic<std::uint8_t>> seen(items);
+  std::vector<std::vector<double>> samples(consumers);
+  std::vector<std::thread> threads;
+
+  auto wait_for_start = [&] {
+    ready++;
+    while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+  };
+  for (int p = 0; p < producers; p++) {
+    threads.emplace_back([&, p] {
+      wait_for_start();
+      for (long i = p; i < items; i += producers) {
+        Item item{static_cast<std::uint64_t>(i), Clock::now()};
+        while (!queue.try_push(item)) std::this_thread::yield();
+      }
+    });
+  }
+  for (int c = 0; c < consumers; c++) {
+    threads.emplace_back([&, c] {
+      wait_for_start();
+      Item item;
+      while (popped.load(std::memory_order_relaxed) < items) {
+        if (!queue.try_pop(item)) {
+          std::this_thread::yield();
+          continue;
+        }
+        if (popped.fetch_add(1, std::memory_order_relaxed) % 64 == 0) {
+          std::chrono::duration<double, std::micro> wait =
+              Clock::now() - item.pushed;
+          samples[c].push_back(wait.count());
+        }
+        if (item.value < static_cast<std::uint64_t>(items))
+          seen[item.value].fetch_add(1, std::memory_order_relaxed);
+        else
+          stray.store(true, std::memory_order_relaxed);
+      }
+    });
+  }
+
+  while (ready.load() < producers + consumers) std::this_thread::yield();
+  Clock::time_point start = Clock::now();
+  go.store(true, std::memory_order_release);
+  for (std::thread &thread : threads) thread.join();
+  std::chrono::duration<double> elapsed = Clock::now() - start;
+
+  bool once = !stray.load();
+  for (std::atomic<std::uint8_t> &count : seen) once = once && count == 1;
+  if (!once) {
+    std::cerr << "concurrent_benchmark: values lost or repeated\n";
+    std::exit(EXIT_FAILURE);
+  }
+  Result result{elapsed.count(), {}};
+  for (std::vector<double> &sample : samples)
+    result.latencies.insert(result.latencies.end(), sample.begin(),
+                            sample.end());
+  std::sort(result.latencies.begin(), result.latencies.end());
+  return result;
+}
+
+// returns the p-th percentile of sorted values
+double percentile(const std::vector<double> &sorted, double p) {
+  if (sorted.empty()) return 0;
+  return sorted[static_cast<std::size_t>(p / 100 * (sorted.size() - 1))];
+}
+
+// prints one row of the table
+void report(const char *name, int producers, int consumers, long items,
+            const Result &result) {
+  std::cout << std::left << std::setw(14) << name << std::right
+            << std::setw(3) << producers << 'x' << std::left << std::setw(3)
+            << consumers << std::right << std::fixed << std::setprecision(2)
+            << std::setw(10) << items / result.seconds / 1e6 << std::setw(11)
+            << percentile(result.latencies, 50) << std::setw(11)
+            << percentile(result.latencies, 99) << '\n';
+}
+
+// usage: concurrent_benchmark [items] [capacity] [max threads per side]
+int main(int argc, char **argv) {
+  long items = argc > 1 ? std::atol(argv[1]) : 2000000;
+  std::size_t capacity = argc > 2 ? std::atol(argv[2]) : 1024;
+  int max_threads = argc > 3 ? std::atoi(argv[3]) : 8;
+  std::cout << "--- " << items << " items, capacity " << capacity << ", "
+            << std::thread::hardware_concurrency() << " hardware threads ---\n"
+            << "queue         threads  Mitems/s  p50 us     p99 us\n";
+
+  {
+    SpscQueue<Item> spsc(capacity);
+    report("SpscQueue", 1, 1, items, run(spsc, 1, 1, items));
+  }
+  // n x n threads, then 1 x n and n x 1
+  std::vector<std::pair<int, int>> sweep;
+  for (int n = 1; n <= max_threads; n *= 2) sweep.emplace_back(n, n);
+  for (int n = 2; n <= max_threads; n *= 2) {
+    sweep.emplace_back(1, n);
+    sweep.emplace_back(n, 1);
+  }
+  for (const std::pair<int, int> &threads : sweep) {
+    int producers = threads.first, consumers = threads.second;
+    MpmcQueue<Item> mpmc(capacity);
+    report("MpmcQueue", producers, consumers, items,
+           run(mpmc, producers, consumers, items));
+    LockedQueue<Item> locked(capacity);
+    report("mutex Queue", producers, consumers, items,
+           run(locked, producers, consumers, items));
+  }
+  return EXIT_SUCCESS;
+}
@@ -7,14 +7,60 @@
  * @brief creates a simple linked list!
  */
 
+#include <cstddef>
 #include <initializer_list>
 #include <iostream>
+#include <iterator>
 
 // Defines a doubly-linked list
 template <typename T>
 class LinkedList {
   struct Node;  // forward declaration for our private Node type
  public:
+  // forward iterator over the elements, from head to one past the tail
+  // Value is T for iterator and const T for const_iterator
+  template <typename Value>
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value *;
+    using reference = Value &;
+
+    Iterator() : node(nullptr) {}
+    // an iterator converts to a const_iterator
+    operator Iterator<const T>() const { return Iterator<const T>(node); }
+
+    reference operator*() const { return node->data; }
+    pointer operator->() const { return &node->data; }
+
+    Iterator &operator++() {
+      node = node->next;
+      return *this;
+    }
+    Iterator operator++(int) {
+      Iterator old = *this;
+      node = node->next;
+      return old;
+    }
+
+    friend bool operator==(const Iterator &a, const Iterator &b) {
+      return a.node == b.node;
+    }
+    friend bool operator!=(const Iterator &a, const Iterator &b) {
+      return a.node != b.node;
+    }
+
+   private:
+    friend class LinkedList;
+    friend class Iterator<T>;
+    explicit Iterator(Node *node) : node(node) {}
+    Node *node;
+  };
+  using iterator = Iterator<T>;
+  using const_iterator = Iterator<const T>;
+
   // default constructor
   LinkedList() : head(nullptr), tail(nullptr), list_size(0) {}
 
@@ -39,11 +85,13 @@ class LinkedList {
     }
   }
 
-  // return head for iteration
-  Node *begin() const { return head; }
-
-  // return tail for iteration
-  Node *end() const { return tail; }
+  // iterators to the head and to one past the tail
+  iterator begin() { return iterator(head); }
+  iterator end() { return iterator(nullptr); }
+  const_iterator begin() const { return const_iterator(head); }
+  const_iterator end() const { return const_iterator(nullptr); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
 
   // returns the value of the head node
   T &front() const {
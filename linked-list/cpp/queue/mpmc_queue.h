@@ -0,0 +1,133 @@
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+/**
+ * @author Ethan Okamura
+ * @file mpmc_queue.h
+ * @brief creates a bounded lock-free queue for any number of producer and
+ *        consumer threads!
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Defines a fixed-size ring buffer shared by any number of threads (Dmitry
+// Vyukov's bounded MPMC queue). Every cell has a sequence number that says
+// whose turn it is:
+//   sequence == pos             empty, ready for the push that claims pos
+//   sequence == pos + 1         full, ready for the pop that claims pos
+//   sequence == pos + capacity  empty again, for the push one lap later
+// A thread claims a position with one compare-and-swap on the shared index,
+// then fills or empties the cell and publishes it by bumping its sequence.
+// The two indices sit on their own cache lines.
+// Once a position is claimed nothing may throw, or its cell would never be
+// published and every thread would stall on it. So T must move without
+// throwing, and a value whose construction can throw is built before the
+// claim and moved in.
+template <typename T>
+class MpmcQueue {
+  static_assert(std::is_nothrow_move_constructible<T>::value &&
+                    std::is_nothrow_move_assignable<T>::value,
+                "MpmcQueue needs a T that moves without throwing");
+
+ public:
+  // capacity is rounded up to a power of two (at least 2)
+  explicit MpmcQueue(std::size_t capacity) : enqueue_pos(0), dequeue_pos(0) {
+    if (capacity == 0) throw std::invalid_argument("zero capacity!");
+    std::size_t size = 2;
+    while (size < capacity) size *= 2;
+    mask = size - 1;
+    cells = new Cell[size];
+    for (std::size_t i = 0; i < size; i++)
+      cells[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  MpmcQueue(const MpmcQueue &) = delete;
+  MpmcQueue &operator=(const MpmcQueue &) = delete;
+  // destructor
+  ~MpmcQueue() {
+    for (std::size_t pos = dequeue_pos.load(); pos != enqueue_pos.load(); pos++)
+      cells[pos & mask].value()->~T();
+    delete[] cells;
+  }
+
+  // pushes a value onto the back
+  // returns false, and pushes nothing, when the queue is full (rvalue
+  // arguments of a T constructor that can throw are still moved from)
+  bool try_push(const T &val) { return try_emplace(val); }
+  bool try_push(T &&val) { return try_emplace(std::move(val)); }
+  template <typename... Args>
+  bool try_emplace(Args &&...args) {
+    if constexpr (!std::is_nothrow_constructible<T, Args &&...>::value) {
+      // may throw, so build it before claiming a cell
+      return try_emplace(T(std::forward<Args>(args)...));
+    }
+    Cell *cell;
+    std::size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+    for (;;) {
+      cell = &cells[pos & mask];
+      std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+      std::ptrdiff_t turn = static_cast<std::ptrdiff_t>(sequence - pos);
+      if (turn == 0) {
+        // our turn: claim pos, or retry with the pos another push took
+        if (enqueue_pos.compare_exchange_weak(pos, pos + 1,
+                                              std::memory_order_relaxed))
+          break;
+      } else if (turn < 0) {
+        return false;  // the pop from one lap ago has not emptied it yet
+      } else {
+        pos = enqueue_pos.load(std::memory_order_relaxed);
+      }
+    }
+    new (cell->storage) T(std::forward<Args>(args)...);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  // moves the front value into out and pops it
+  // returns false, and leaves out alone, when the queue is empty
+  bool try_pop(T &out) {
+    Cell *cell;
+    std::size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+    for (;;) {
+      cell = &cells[pos & mask];
+      std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+      std::ptrdiff_t turn = static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+      if (turn == 0) {
+        if (dequeue_pos.compare_exchange_weak(pos, pos + 1,
+                                              std::memory_order_relaxed))
+          break;
+      } else if (turn < 0) {
+        return false;  // the push that claimed pos has not filled it yet
+      } else {
+        pos = dequeue_pos.load(std::memory_order_relaxed);
+      }
+    }
+    T *val = cell->value();
+    out = std::move(*val);
+    val->~T();
+    cell->sequence.store(pos + mask + 1, std::memory_order_release);
+    return true;
+  }
+
+  // returns the number of values the queue holds when full
+  std::size_t capacity() const { return mask + 1; }
+
+ private:
+  static constexpr std::size_t CACHE_LINE = 64;
+  struct Cell {
+    std::atomic<std::size_t> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+    T *value() { return std::launder(reinterpret_cast<T *>(storage)); }
+  };
+  alignas(CACHE_LINE) std::atomic<std::size_t> enqueue_pos;
+  alignas(CACHE_LINE) std::atomic<std::size_t> dequeue_pos;
+  // read-only after construction
+  alignas(CACHE_LINE) Cell *cells;
+  std::size_t mask;  // capacity - 1
+};
+
+#endif  // MPMC_QUEUE_H
@@ -7,28 +7,176 @@
  * @brief creates a simple queue class!
  */
 
-#include "linked_list.h"
+#include <cstddef>
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <utility>
 
-// Defines a stack that uses a doubly-linked list as a data structure.
+// Defines a queue that uses a ring buffer as a data structure.
+// The elements sit in one array whose capacity is a power of two, so the
+// index after the back wraps to the front with a mask instead of a modulo.
+// A full buffer doubles, so push() is amortized O(1) with no allocation per
+// element.
 template <typename T>
-class Queue : private LinkedList<T> {
+class Queue {
  public:
   // default constructor
-  Queue() : LinkedList<T>() {}
+  Queue() : data(nullptr), capacity(0), head(0), count(0) {}
   // list constructor
-  Queue(std::initializer_list<T> init_list) : LinkedList<T>() {
-    for (const std::string& val : init_list) this->push_back(val);
-  }
-  // pushes a string to the top of the stack
-  void push(T val) { this->push_back(val); }
-  // pops off the top value in the stack
-  void pop() { this->pop_front(); }
-  // returns the data at the top of the stack
-  T& front() const { return this->LinkedList<T>::front(); }
-  // checks if the stack is empty (bool return value)
-  bool empty() const { return this->LinkedList<T>::empty(); }
-  // returns the size of the stack
-  int size() const { return this->LinkedList<T>::size(); }
+  Queue(std::initializer_list<T> init_list) : Queue() {
+    reserve(init_list.size());
+    for (const T& val : init_list) push(val);
+  }
+  // copy constructor
+  Queue(const Queue& another) : Queue() {
+    reserve(another.count);
+    for (std::size_t i = 0; i < another.count; i++) push(another.at(i));
+  }
+  // move constructor
+  // takes over the buffer of another, leaving it empty
+  Queue(Queue&& another) noexcept : Queue() { swap(another); }
+  // destructor
+  ~Queue() {
+    clear();
+    ::operator delete(data);
+  }
+  // assigns queue to a copy of another
+  Queue& operator=(const Queue& another) {
+    if (this != &another) {
+      Queue copy(another);
+      swap(copy);
+    }
+    return *this;
+  }
+  // moves another into this queue
+  Queue& operator=(Queue&& another) noexcept {
+    if (this != &another) swap(another);
+    return *this;
+  }
+
+  // pushes a value onto the back of the queue
+  void push(const T& val) { emplace(val); }
+  void push(T&& val) { emplace(std::move(val)); }
+  // constructs a new back value in place from args
+  template <typename... Args>
+  T& emplace(Args&&... args) {
+    if (count < capacity) {
+      T* slot = data + ((head + count) & (capacity - 1));
+      new (slot) T(std::forward<Args>(args)...);
+      count++;
+      return *slot;
+    }
+    // a full buffer: args may refer to a value in it, so build the new
+    // value in the new buffer before the old values move out
+    std::size_t new_capacity = capacity ? 2 * capacity : MIN_CAPACITY;
+    T* new_data = static_cast<T*>(::operator new(new_capacity * sizeof(T)));
+    T* slot = new_data + count;
+    try {
+      new (slot) T(std::forward<Args>(args)...);
+    } catch (...) {
+      ::operator delete(new_data);
+      throw;
+    }
+    try {
+      transfer(new_data);
+    } catch (...) {
+      slot->~T();
+      ::operator delete(new_data);
+      throw;
+    }
+    adopt(new_data, new_capacity);
+    count++;
+    return *slot;
+  }
+  // pops off the front value in the queue
+  void pop() {
+    if (empty()) throw std::domain_error("empty queue!");
+    data[head].~T();
+    head = (head + 1) & (capacity - 1);
+    count--;
+  }
+  // returns the data at the front of the queue
+  T& front() {
+    if (empty()) throw std::domain_error("empty queue!");
+    return data[head];
+  }
+  const T& front() const {
+    if (empty()) throw std::domain_error("empty queue!");
+    return data[head];
+  }
+  // checks if the queue is empty (bool return value)
+  bool empty() const { return count == 0; }
+  // returns the size of the queue
+  int size() const { return count; }
+  // makes room for n values without growing again
+  void reserve(std::size_t n) {
+    if (n <= capacity) return;
+    std::size_t new_capacity = MIN_CAPACITY;
+    while (new_capacity < n) new_capacity *= 2;
+    grow(new_capacity);
+  }
+  // pops every value, keeping the buffer
+  void clear() {
+    while (!empty()) pop();
+  }
+
+ private:
+  static constexpr std::size_t MIN_CAPACITY = 16;
+  T* data;               // ring buffer of capacity slots
+  std::size_t capacity;  // 0 or a power of two
+  std::size_t head;      // index of the front value
+  std::size_t count;     // number of values
+
+  // returns the value i places behind the front
+  const T& at(std::size_t i) const {
+    return data[(head + i) & (capacity - 1)];
+  }
+
+  // moves the values, front first, into a new buffer of new_capacity slots
+  void grow(std::size_t new_capacity) {
+    T* new_data = static_cast<T*>(::operator new(new_capacity * sizeof(T)));
+    try {
+      transfer(new_data);
+    } catch (...) {
+      ::operator delete(new_data);
+      throw;
+    }
+    adopt(new_data, new_capacity);
+  }
+
+  // moves the values, front first, into new_data, then destroys them and
+  // frees the buffer. Values are copied instead if moving them could
+  // throw, and nothing is destroyed until every one is over, so if a copy
+  // throws the queue is left as it was.
+  void transfer(T* new_data) {
+    std::size_t i = 0;
+    try {
+      for (; i < count; i++)
+        new (new_data + i) T(std::move_if_noexcept(
+            data[(head + i) & (capacity - 1)]));
+    } catch (...) {
+      while (i > 0) new_data[--i].~T();
+      throw;
+    }
+    for (i = 0; i < count; i++) data[(head + i) & (capacity - 1)].~T();
+    ::operator delete(data);
+  }
+
+  // takes new_data, filled front first by transfer(), as the buffer
+  void adopt(T* new_data, std::size_t new_capacity) {
+    data = new_data;
+    capacity = new_capacity;
+    head = 0;
+  }
+
+  // exchanges the buffers of this queue and another
+  void swap(Queue& another) noexcept {
+    std::swap(data, another.data);
+    std::swap(capacity, another.capacity);
+    std::swap(head, another.head);
+    std::swap(count, another.count);
+  }
 };
 
 #endif  // QUEUE_H
@@ -0,0 +1,92 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+/**
+ * @author Ethan Okamura
+ * @file spsc_queue.h
+ * @brief creates a bounded lock-free queue for one producer thread and one
+ *        consumer thread!
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+// Defines a fixed-size ring buffer shared by exactly two threads: one calls
+// try_push(), the other calls try_pop(). Each index is written by only one
+// thread, so neither side needs a lock or a compare-and-swap, just an acquire
+// load of the other side's index. Each index sits on its own cache line, so
+// the two threads do not keep stealing one line from each other.
+template <typename T>
+class SpscQueue {
+ public:
+  // capacity is rounded up to a power of two
+  explicit SpscQueue(std::size_t capacity)
+      : tail(0), cached_head(0), head(0), cached_tail(0) {
+    if (capacity == 0) throw std::invalid_argument("zero capacity!");
+    std::size_t size = 1;
+    while (size < capacity) size *= 2;
+    mask = size - 1;
+    slots = static_cast<T *>(::operator new(size * sizeof(T)));
+  }
+  SpscQueue(const SpscQueue &) = delete;
+  SpscQueue &operator=(const SpscQueue &) = delete;
+  // destructor
+  ~SpscQueue() {
+    for (std::size_t i = head.load(); i != tail.load(); i++)
+      slots[i & mask].~T();
+    ::operator delete(slots);
+  }
+
+  // producer: pushes a value onto the back
+  // returns false, and pushes nothing, when the queue is full
+  bool try_push(const T &val) { return try_emplace(val); }
+  bool try_push(T &&val) { return try_emplace(std::move(val)); }
+  template <typename... Args>
+  bool try_emplace(Args &&...args) {
+    std::size_t back = tail.load(std::memory_order_relaxed);
+    if (back - cached_head > mask) {
+      // looks full: fetch the consumer's progress and check again
+      cached_head = head.load(std::memory_order_acquire);
+      if (back - cached_head > mask) return false;
+    }
+    new (slots + (back & mask)) T(std::forward<Args>(args)...);
+    tail.store(back + 1, std::memory_order_release);
+    return true;
+  }
+
+  // consumer: moves the front value into out and pops it
+  // returns false, and leaves out alone, when the queue is empty
+  bool try_pop(T &out) {
+    std::size_t front = head.load(std::memory_order_relaxed);
+    if (front == cached_tail) {
+      // looks empty: fetch the producer's progress and check again
+      cached_tail = tail.load(std::memory_order_acquire);
+      if (front == cached_tail) return false;
+    }
+    T &val = slots[front & mask];
+    out = std::move(val);
+    val.~T();
+    head.store(front + 1, std::memory_order_release);
+    return true;
+  }
+
+  // returns the number of values the queue holds when full
+  std::size_t capacity() const { return mask + 1; }
+
+ private:
+  static constexpr std::size_t CACHE_LINE = 64;
+  // written by the producer
+  alignas(CACHE_LINE) std::atomic<std::size_t> tail;  // next slot to fill
+  std::size_t cached_head;  // last head the producer saw
+  // written by the consumer
+  alignas(CACHE_LINE) std::atomic<std::size_t> head;  // next slot to empty
+  std::size_t cached_tail;  // last tail the consumer saw
+  // read-only after construction
+  alignas(CACHE_LINE) T *slots;
+  std::size_t mask;  // capacity - 1; indices grow forever and wrap with it
+};
+
+#endif  // SPSC_QUEUE_H
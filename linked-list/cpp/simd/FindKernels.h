@@ -0,0 +1,261 @@
+/**
+ * @author Ethan Okamura
+ * @file FindKernels.h
+ * @brief Header-only search kernels for the unrolled list: the first or
+ *        last x in an array of long or int, with AVX2, SSE4.2 or scalar
+ *        code picked at runtime. The bigint limb kernels share its
+ *        SimdLevel dispatch
+ * @status: working / tested
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#ifndef FIND_KERNELS_H_INCLUDE_
+#define FIND_KERNELS_H_INCLUDE_
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define FIND_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+// The vector code is compiled with per-function target attributes, so no
+// -mavx2 is needed and the binary still runs on CPUs without it. Callers
+// should build with -O2: intrinsics are not inlined at -O0.
+
+// Instruction sets the kernels can run on, slowest first.
+enum class SimdLevel { SCALAR, SSE4, AVX2 };
+
+// detectSimdLevel()
+// Returns the fastest SimdLevel this CPU supports.
+inline SimdLevel detectSimdLevel() {
+#ifdef FIND_KERNELS_X86
+  if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+  if (__builtin_cpu_supports("sse4.2")) return SimdLevel::SSE4;
+#endif
+  return SimdLevel::SCALAR;
+}
+
+// Scalar kernels -------------------------------------------------------------
+// These also finish the tails the vector kernels leave.
+
+// findFirstScalar()
+template <typename T>
+inline size_t findFirstScalar(const T *A, size_t n, T x) {
+  for (size_t i = 0; i < n; i++) {
+    if (A[i] == x) return i;
+  }
+  return n;
+}
+
+// findLastScalar()
+template <typename T>
+inline size_t findLastScalar(const T *A, size_t n, T x) {
+  for (size_t i = n; i > 0; i--) {
+    if (A[i - 1] == x) return i - 1;
+  }
+  return n;
+}
+
+#ifdef FIND_KERNELS_X86
+
+// AVX2 kernels ---------------------------------------------------------------
+// Each step compares two vectors and only looks at the lane masks when one
+// of them matched: 8 longs or 16 ints per step.
+
+// findFirstAvx2()
+__attribute__((target("avx2"))) inline size_t findFirstAvx2(const long *A,
+                                                            size_t n, long x) {
+  const __m256i key = _mm256_set1_epi64x(x);
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256i lo = _mm256_cmpeq_epi64(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(A + i)), key);
+    __m256i hi = _mm256_cmpeq_epi64(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(A + i + 4)), key);
+    __m256i any = _mm256_or_si256(lo, hi);
+    if (_mm256_testz_si256(any, any)) continue;
+    uint32_t bits = _mm256_movemask_pd(_mm256_castsi256_pd(lo)) |
+                    _mm256_movemask_pd(_mm256_castsi256_pd(hi)) << 4;
+    return i + __builtin_ctz(bits);
+  }
+  size_t tail = findFirstScalar(A + i, n - i, x);
+  return tail == n - i ? n : i + tail;
+}
+__attribute__((target("avx2"))) inline size_t findFirstAvx2(const int *A,
+                                                            size_t n, int x) {
+  const __m256i key = _mm256_set1_epi32(x);
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m256i lo = _mm256_cmpeq_epi32(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(A + i)), key);
+    __m256i hi = _mm256_cmpeq_epi32(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(A + i + 8)), key);
+    __m256i any = _mm256_or_si256(lo, hi);
+    if (_mm256_testz_si256(any, any)) continue;
+    uint32_t bits = _mm256_movemask_ps(_mm256_castsi256_ps(lo)) |
+                    _mm256_movemask_ps(_mm256_castsi256_ps(hi)) << 8;
+    return i + __builtin_ctz(bits);
+  }
+  size_t tail = findFirstScalar(A + i, n - i, x);
+  return tail == n - i ? n : i + tail;
+}
+
+// findLastAvx2()
+__attribute__((target("avx2"))) inline size_t findLastAvx2(const long *A,
+                                                           size_t n, long x) {
+  const __m256i key = _mm256_set1_epi64x(x);
+  size_t i = n;
+  for (; i >= 8; i -= 8) {
+    __m256i lo = _mm256_cmpeq_epi64(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(A + i - 8)), key);
+    __m256i hi = _mm256_cmpeq_epi64(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(A + i - 4)), key);
+    __m256i any = _mm256_or_si256(lo, hi);
+    if (_mm256_testz_si256(any, any)) continue;
+    uint32_t bits = _mm256_movemask_pd(_mm256_castsi256_pd(lo)) |
+                    _mm256_movemask_pd(_mm256_castsi256_pd(hi)) << 4;
+    return i - 8 + (31 - __builtin_clz(bits));
+  }
+  size_t tail = findLastScalar(A, i, x);
+  return tail == i ? n : tail;
+}
+__attribute__((target("avx2"))) inline size_t findLastAvx2(const int *A,
+                                                           size_t n, int x) {
+  const __m256i key = _mm256_set1_epi32(x);
+  size_t i = n;
+  for (; i >= 16; i -= 16) {
+    __m256i lo = _mm256_cmpeq_epi32(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(A + i - 16)),
+        key);
+    __m256i hi = _mm256_cmpeq_epi32(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(A + i - 8)), key);
+    __m256i any = _mm256_or_si256(lo, hi);
+    if (_mm256_testz_si256(any, any)) continue;
+    uint32_t bits = _mm256_movemask_ps(_mm256_castsi256_ps(lo)) |
+                    _mm256_movemask_ps(_mm256_castsi256_ps(hi)) << 8;
+    return i - 16 + (31 - __builtin_clz(bits));
+  }
+  size_t tail = findLastScalar(A, i, x);
+  return tail == i ? n : tail;
+}
+
+// SSE4.2 kernels -------------------------------------------------------------
+// As the AVX2 kernels, with half as many lanes: 4 longs or 8 ints per step.
+
+// findFirstSse4()
+__attribute__((target("sse4.2"))) inline size_t findFirstSse4(const long *A,
+                                                              size_t n,
+                                                              long x) {
+  const __m128i key = _mm_set1_epi64x(x);
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128i lo = _mm_cmpeq_epi64(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(A + i)), key);
+    __m128i hi = _mm_cmpeq_epi64(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(A + i + 2)), key);
+    uint32_t bits = _mm_movemask_pd(_mm_castsi128_pd(lo)) |
+                    _mm_movemask_pd(_mm_castsi128_pd(hi)) << 2;
+    if (bits) return i + __builtin_ctz(bits);
+  }
+  size_t tail = findFirstScalar(A + i, n - i, x);
+  return tail == n - i ? n : i + tail;
+}
+__attribute__((target("sse4.2"))) inline size_t findFirstSse4(const int *A,
+                                                              size_t n, int x) {
+  const __m128i key = _mm_set1_epi32(x);
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m128i lo = _mm_cmpeq_epi32(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(A + i)), key);
+    __m128i hi = _mm_cmpeq_epi32(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(A + i + 4)), key);
+    uint32_t bits = _mm_movemask_ps(_mm_castsi128_ps(lo)) |
+                    _mm_movemask_ps(_mm_castsi128_ps(hi)) << 4;
+    if (bits) return i + __builtin_ctz(bits);
+  }
+  size_t tail = findFirstScalar(A + i, n - i, x);
+  return tail == n - i ? n : i + tail;
+}
+
+// findLastSse4()
+__attribute__((target("sse4.2"))) inline size_t findLastSse4(const long *A,
+                                                             size_t n,
+                                                             long x) {
+  const __m128i key = _mm_set1_epi64x(x);
+  size_t i = n;
+  for (; i >= 4; i -= 4) {
+    __m128i lo = _mm_cmpeq_epi64(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(A + i - 4)), key);
+    __m128i hi = _mm_cmpeq_epi64(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(A + i - 2)), key);
+    uint32_t bits = _mm_movemask_pd(_mm_castsi128_pd(lo)) |
+                    _mm_movemask_pd(_mm_castsi128_pd(hi)) << 2;
+    if (bits) return i - 4 + (31 - __builtin_clz(bits));
+  }
+  size_t tail = findLastScalar(A, i, x);
+  return tail == i ? n : tail;
+}
+__attribute__((target("sse4.2"))) inline size_t findLastSse4(const int *A,
+                                                             size_t n, int x) {
+  const __m128i key = _mm_set1_epi32(x);
+  size_t i = n;
+  for (; i >= 8; i -= 8) {
+    __m128i lo = _mm_cmpeq_epi32(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(A + i - 8)), key);
+    __m128i hi = _mm_cmpeq_epi32(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(A + i - 4)), key);
+    uint32_t bits = _mm_movemask_ps(_mm_castsi128_ps(lo)) |
+                    _mm_movemask_ps(_mm_castsi128_ps(hi)) << 4;
+    if (bits) return i - 8 + (31 - __builtin_clz(bits));
+  }
+  size_t tail = findLastScalar(A, i, x);
+  return tail == i ? n : tail;
+}
+
+#endif
+
+// Dispatch -------------------------------------------------------------------
+// T is long or int.
+
+// findFirstN()
+// Returns the index of the first x in A[0, n), or n if there is none.
+// pre: level <= detectSimdLevel()
+template <typename T>
+inline size_t findFirstN(const T *A, size_t n, T x, SimdLevel level) {
+#ifdef FIND_KERNELS_X86
+  switch (level) {
+    case SimdLevel::AVX2:
+      return findFirstAvx2(A, n, x);
+    case SimdLevel::SSE4:
+      return findFirstSse4(A, n, x);
+    default:
+      break;
+  }
+#else
+  (void)level;
+#endif
+  return findFirstScalar(A, n, x);
+}
+
+// findLastN()
+// Returns the index of the last x in A[0, n), or n if there is none.
+// pre: level <= detectSimdLevel()
+template <typename T>
+inline size_t findLastN(const T *A, size_t n, T x, SimdLevel level) {
+#ifdef FIND_KERNELS_X86
+  switch (level) {
+    case SimdLevel::AVX2:
+      return findLastAvx2(A, n, x);
+    case SimdLevel::SSE4:
+      return findLastSse4(A, n, x);
+    default:
+      break;
+  }
+#else
+  (void)level;
+#endif
+  return findLastScalar(A, n, x);
+}
+
+#endif
@@ -0,0 +1,47 @@
+/**
+ * @author Ethan Okamura
+ * @file benchmark.cpp
+ * @brief times pushes and pops on the vector-backed Stack and the linked
+ *        LinkedStack
+ */
+
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+
+#include "linked_stack.h"
+#include "stack.h"
+
+// returns the seconds taken to push n values onto an empty StackType, then
+// pop them all, rounds times
+template <typename StackType>
+double time_stack(const char *name, int n, int rounds) {
+  StackType stack;
+  long long sum = 0;
+  std::clock_t time = std::clock();  // start
+  for (int round = 0; round < rounds; round++) {
+    for (int i = 0; i < n; i++) stack.push(i);
+    while (!stack.is_empty()) {
+      sum += stack.top();
+      stack.pop();
+    }
+  }
+  time = std::clock() - time;  // stop
+  if (sum != static_cast<long long>(n) * (n - 1) / 2 * rounds)
+    std::exit(EXIT_FAILURE);
+  double seconds = static_cast<double>(time) / CLOCKS_PER_SEC;
+  std::cout << name << ": " << seconds << " s\n";
+  return seconds;
+}
+
+// usage: benchmark [values] [rounds]
+int main(int argc, char **argv) {
+  int n = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  int rounds = argc > 2 ? std::atoi(argv[2]) : 10;
+  std::cout << "--- " << rounds << " rounds of " << n
+            << " pushes and pops ---\n";
+  double vec = time_stack<Stack<int>>("Stack", n, rounds);
+  double linked = time_stack<LinkedStack<int>>("LinkedStack", n, rounds);
+  std::cout << "Stack is " << linked / vec << "x faster\n";
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,101 @@
+/**
+ * @author Ethan Okamura
+ * @file concurrent_benchmark.cpp
+ * @brief times the LockFreeStack, with and without elimination, against a
+ *        Stack behind a mutex, used as a free list by 1 to 32 threads
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "lockfree_stack.h"
+#include "stack.h"
+
+// a Stack behind one mutex, with the same try_pop() as LockFreeStack
+template <typename T>
+class LockedStack {
+ public:
+  void push(const T &val) {
+    std::lock_guard<std::mutex> lock(mutex);
+    stack.push(val);
+  }
+  bool try_pop(T &out) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (stack.is_empty()) return false;
+    out = stack.top();
+    stack.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex;
+  Stack<T> stack;
+};
+
+// fills stack with the values 0 .. free_values - 1, then has threads each
+// pop a value and push it back ops / threads times, like a shared free list
+// checks that the same values are left and returns millions of ops / s
+template <typename StackType>
+double run(StackType &stack, int threads, long ops, int free_values) {
+  for (int i = 0; i < free_values; i++) stack.push(i);
+  std::vector<std::thread> workers;
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  for (int t = 0; t < threads; t++) {
+    workers.emplace_back([&] {
+      int val;
+      for (long i = 0; i < ops / threads; i++) {
+        while (!stack.try_pop(val)) std::this_thread::yield();
+        stack.push(val);
+      }
+    });
+  }
+  for (std::thread &worker : workers) worker.join();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  // how many times each value is left; a sum and a count alone would let a
+  // lost value and a repeated one cancel out
+  std::vector<int> seen(free_values);
+  bool once = true;  // false once a value outside 0 .. free_values - 1 shows
+  int val;
+  while (stack.try_pop(val)) {
+    if (val >= 0 && val < free_values)
+      seen[val]++;
+    else
+      once = false;
+  }
+  for (int count : seen) once = once && count == 1;
+  if (!once) {
+    std::cerr << "concurrent_benchmark: values lost or repeated\n";
+    std::exit(EXIT_FAILURE);
+  }
+  return ops / threads * threads / elapsed.count() / 1e6;
+}
+
+// usage: concurrent_benchmark [ops] [max threads] [free values]
+int main(int argc, char **argv) {
+  long ops = argc > 1 ? std::atol(argv[1]) : 2000000;
+  int max_threads = argc > 2 ? std::atoi(argv[2]) : 32;
+  int free_values = argc > 3 ? std::atoi(argv[3]) : 64;
+  std::cout << "--- " << ops << " pop/push pairs over " << free_values
+            << " values, " << std::thread::hardware_concurrency()
+            << " hardware threads, Mops/s ---\n"
+            << "threads   mutex Stack   LockFreeStack   + elimination\n";
+  for (int threads = 1; threads <= max_threads; threads *= 2) {
+    LockedStack<int> locked;
+    LockFreeStack<int> lock_free;
+    LockFreeStack<int> eliminating(true);
+    std::cout << std::fixed << std::setprecision(2) << std::setw(7) << threads
+              << std::setw(14) << run(locked, threads, ops, free_values)
+              << std::setw(16) << run(lock_free, threads, ops, free_values)
+              << std::setw(16) << run(eliminating, threads, ops, free_values)
+              << '\n';
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,160 @@
+#ifndef EPOCH_H
+#define EPOCH_H
+
+/**
+ * @author Ethan Okamura
+ * @file epoch.h
+ * @brief creates an epoch-based reclaimer, which frees nodes that other
+ *        threads may still be reading only once they are done!
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Defines epoch-based reclamation for a lock-free structure made of Nodes.
+// A thread pins itself before reading shared nodes and unpins when done.
+// An unlinked node is retired rather than deleted, tagged with the global
+// epoch. The global epoch only advances when every pinned thread has seen
+// the current one, so a pinned thread holds it back by at most one step.
+// A node retired at epoch e is therefore unreachable by every thread once
+// the epoch reaches e + 2, and only then is it deleted. A node's memory is
+// never reused while a thread that was pinned when it was retired is still
+// pinned. So compare-and-swap on a node pointer is safe from ABA, but only
+// for a thread that stays pinned from reading the pointer to its last
+// compare against it.
+//
+// Threads borrow one of MAX_SLOTS slots for each pin, so no thread has to
+// register or unregister. Each slot keeps its retired nodes in three lists,
+// one per epoch mod 3, so freeing never scans nodes that must stay. Retired
+// nodes stay with the slot until a later holder of the slot frees them, or
+// until the domain is destroyed.
+template <typename Node>
+class EpochDomain {
+  struct Slot;
+
+ public:
+  static constexpr std::size_t MAX_SLOTS = 128;
+
+  // keeps the calling thread pinned until it is destroyed
+  class Guard {
+   public:
+    Guard(Guard &&other) noexcept : domain(other.domain), slot(other.slot) {
+      other.slot = nullptr;
+    }
+    Guard(const Guard &) = delete;
+    Guard &operator=(const Guard &) = delete;
+    ~Guard() {
+      if (slot) domain->unpin(slot);
+    }
+
+   private:
+    friend class EpochDomain;
+    Guard(EpochDomain *domain, Slot *slot) : domain(domain), slot(slot) {}
+    EpochDomain *domain;
+    Slot *slot;
+  };
+
+  EpochDomain() : global_epoch(0) {}
+  EpochDomain(const EpochDomain &) = delete;
+  EpochDomain &operator=(const EpochDomain &) = delete;
+  // destructor
+  // deletes every retired node; no thread may still be pinned
+  ~EpochDomain() {
+    for (Slot &slot : slots)
+      for (std::vector<Node *> &retired : slot.retired)
+        for (Node *node : retired) delete node;
+  }
+
+  // pins the calling thread until the returned Guard is destroyed
+  Guard pin() {
+    Slot *slot = claim_slot();
+    // publish the pinned epoch before reading any shared node; release so
+    // a thread that sees it also sees this slot's earlier reads as done
+    slot->epoch.store(global_epoch.load(std::memory_order_relaxed),
+                      std::memory_order_release);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return Guard(this, slot);
+  }
+
+  // hands over an unlinked node to be deleted when no thread can reach it
+  // pre: guard is held by the calling thread
+  void retire(const Guard &guard, Node *node) {
+    Slot *slot = guard.slot;
+    // acquire: the advances that make old nodes safe happen before the free
+    std::uint64_t epoch = global_epoch.load(std::memory_order_acquire);
+    free_before(slot, epoch);
+    slot->retired[epoch % 3].push_back(node);
+    slot->retired_epoch[epoch % 3] = epoch;
+    if (++slot->retire_count % ADVANCE_EVERY == 0) try_advance();
+  }
+
+ private:
+  static constexpr std::size_t CACHE_LINE = 64;
+  static constexpr std::size_t ADVANCE_EVERY = 64;
+  static constexpr std::uint64_t IDLE = ~std::uint64_t(0);
+
+  struct alignas(CACHE_LINE) Slot {
+    std::atomic<bool> in_use{false};
+    std::atomic<std::uint64_t> epoch{IDLE};  // pinned epoch, or IDLE
+    // only touched by the holder: nodes retired at retired_epoch[e % 3]
+    std::vector<Node *> retired[3];
+    std::uint64_t retired_epoch[3] = {0, 0, 0};
+    std::size_t retire_count = 0;
+  };
+
+  alignas(CACHE_LINE) std::atomic<std::uint64_t> global_epoch;
+  Slot slots[MAX_SLOTS];
+
+  // borrows a free slot, starting from one picked by the thread id so
+  // threads rarely collide
+  Slot *claim_slot() {
+    static thread_local std::size_t hint =
+        std::hash<std::thread::id>()(std::this_thread::get_id()) % MAX_SLOTS;
+    for (std::size_t i = hint;; i = (i + 1) % MAX_SLOTS) {
+      Slot &slot = slots[i];
+      bool free = false;
+      if (!slot.in_use.load(std::memory_order_relaxed) &&
+          slot.in_use.compare_exchange_strong(free, true,
+                                              std::memory_order_acquire)) {
+        hint = i;
+        return &slot;
+      }
+      if ((i + 1) % MAX_SLOTS == hint) std::this_thread::yield();
+    }
+  }
+
+  // unpins and gives the slot back
+  void unpin(Slot *slot) {
+    slot->epoch.store(IDLE, std::memory_order_release);
+    slot->in_use.store(false, std::memory_order_release);
+  }
+
+  // deletes the nodes of slot retired two or more epochs before epoch
+  void free_before(Slot *slot, std::uint64_t epoch) {
+    for (int i = 0; i < 3; i++) {
+      std::vector<Node *> &retired = slot->retired[i];
+      if (retired.empty() || slot->retired_epoch[i] + 2 > epoch) continue;
+      for (Node *node : retired) delete node;
+      retired.clear();
+    }
+  }
+
+  // advances the global epoch if every pinned thread has seen it
+  void try_advance() {
+    std::uint64_t epoch = global_epoch.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (Slot &other : slots) {
+      std::uint64_t pinned = other.epoch.load(std::memory_order_acquire);
+      if (pinned != IDLE && pinned != epoch) return;
+    }
+    global_epoch.compare_exchange_strong(epoch, epoch + 1,
+                                         std::memory_order_acq_rel);
+  }
+};
+
+#endif  // EPOCH_H
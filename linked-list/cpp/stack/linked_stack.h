@@ -0,0 +1,38 @@
+#ifndef LINKED_STACK_H
+#define LINKED_STACK_H
+
+/**
+ * @author Ethan Okamura
+ * @file linked_stack.h
+ * @brief creates a simple stack class on a linked list!
+ *        (stack.h has the faster vector-backed Stack)
+ */
+
+#include "../linked_list/linked_list.h"
+
+// Defines a stack that uses a doubly-linked list as a data structure.
+template <typename T>
+class LinkedStack {
+ public:
+  // default constructor
+  LinkedStack() : _ll{} {}
+  // list constructor
+  LinkedStack(std::initializer_list<T> init_list) {
+    for (const T& val : init_list) this->_ll.push_front(val);
+  }
+  // pushes a string to the top of the stack
+  void push(T val) { this->_ll.push_front(val); }
+  // pops off the top value in the stack
+  void pop() { this->_ll.pop_front(); }
+  // returns the data at the top of the stack
+  T& top() { return this->_ll.front(); }
+  // checks if the stack is empty (bool return value)
+  bool is_empty() { return this->_ll.empty(); }
+  // returns the size of the stack
+  int size() { return this->_ll.size(); }
+
+ private:
+  LinkedList<T> _ll;
+};
+
+#endif  // LINKED_STACK_H
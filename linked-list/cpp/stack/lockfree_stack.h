@@ -0,0 +1,158 @@
+#ifndef LOCKFREE_STACK_H
+#define LOCKFREE_STACK_H
+
+/**
+ * @author Ethan Okamura
+ * @file lockfree_stack.h
+ * @brief creates a lock-free stack that many threads can share without a
+ *        mutex!
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <random>
+#include <thread>
+#include <utility>
+
+#include "epoch.h"
+
+// Defines a Treiber stack: a singly linked list whose head is swapped in
+// with compare-and-swap. A push links its node in front of the head it read
+// and retries if another thread changed the head first; a pop swings the
+// head to the next node. Popped nodes are retired to an EpochDomain, so a
+// thread that read the old head can still follow its next link safely.
+//
+// With elimination on, a push or pop that loses the race on the head tries
+// the elimination array before retrying: a push leaves its node in a random
+// slot for a moment, and a pop that finds it there takes the value straight
+// from it. The two cancel out without touching the head at all, which helps
+// when many threads hammer the stack at once. A taken node is retired too,
+// and the push stays pinned while its node is on offer.
+template <typename T>
+class LockFreeStack {
+  struct Node;
+
+ public:
+  // default constructor
+  explicit LockFreeStack(bool elimination = false)
+      : head(nullptr), eliminate(elimination) {
+    for (std::atomic<Node *> &offer : exchange) offer.store(nullptr);
+  }
+  LockFreeStack(const LockFreeStack &) = delete;
+  LockFreeStack &operator=(const LockFreeStack &) = delete;
+  // destructor
+  // no thread may still be using the stack
+  ~LockFreeStack() {
+    Node *current = head.load();
+    while (current) {
+      Node *next = current->next;
+      delete current;
+      current = next;
+    }
+  }
+
+  // pushes a value to the top of the stack
+  void push(const T &val) { emplace(val); }
+  void push(T &&val) { emplace(std::move(val)); }
+  // constructs a new top value from args
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    Node *node = new Node(std::forward<Args>(args)...);
+    node->next = head.load(std::memory_order_relaxed);
+    while (!head.compare_exchange_weak(node->next, node,
+                                       std::memory_order_release,
+                                       std::memory_order_relaxed)) {
+      if (eliminate && offer(node)) return;
+    }
+  }
+
+  // moves the top value into out and pops it
+  // returns false, and leaves out alone, when the stack is empty
+  bool try_pop(T &out) {
+    typename EpochDomain<Node>::Guard guard = epochs.pin();
+    Node *top = head.load(std::memory_order_acquire);
+    while (top) {
+      // top cannot be freed while this thread is pinned
+      if (head.compare_exchange_weak(top, top->next,
+                                     std::memory_order_acquire,
+                                     std::memory_order_acquire)) {
+        out = std::move(top->data);
+        epochs.retire(guard, top);
+        return true;
+      }
+      if (eliminate) {
+        if (Node *node = take()) {
+          // never reachable from head, but its pusher may still compare
+          // the slot against it, so it is retired like a popped node
+          out = std::move(node->data);
+          epochs.retire(guard, node);
+          return true;
+        }
+        top = head.load(std::memory_order_acquire);
+      }
+    }
+    return false;
+  }
+
+  // checks if the stack is empty (bool return value)
+  // another thread may change the answer right away
+  bool is_empty() const {
+    return head.load(std::memory_order_acquire) == nullptr;
+  }
+
+ private:
+  static constexpr std::size_t CACHE_LINE = 64;
+  static constexpr std::size_t EXCHANGE_SLOTS = 8;
+  static constexpr int OFFER_SPINS = 64;
+  struct Node {
+    T data;
+    Node *next = nullptr;
+    template <typename... Args>
+    explicit Node(Args &&...args) : data(std::forward<Args>(args)...) {}
+  };
+
+  alignas(CACHE_LINE) std::atomic<Node *> head;
+  alignas(CACHE_LINE) std::atomic<Node *> exchange[EXCHANGE_SLOTS];
+  bool eliminate;
+  EpochDomain<Node> epochs;
+
+  // returns a random elimination slot
+  std::atomic<Node *> &random_slot() {
+    static thread_local std::minstd_rand gen(
+        std::hash<std::thread::id>()(std::this_thread::get_id()));
+    return exchange[gen() % EXCHANGE_SLOTS];
+  }
+
+  // push side: leaves node in a slot for a while
+  // returns true if a pop took it
+  bool offer(Node *node) {
+    // stay pinned while node may be compared against the slot: a pop that
+    // takes node retires it, so its memory cannot come back into the slot
+    // through another push before the withdraw below
+    typename EpochDomain<Node>::Guard guard = epochs.pin();
+    std::atomic<Node *> &slot = random_slot();
+    Node *empty = nullptr;
+    if (!slot.compare_exchange_strong(empty, node, std::memory_order_release,
+                                      std::memory_order_relaxed))
+      return false;
+    for (int spin = 0; spin < OFFER_SPINS; spin++) {
+      if (slot.load(std::memory_order_relaxed) != node) return true;
+    }
+    // withdraw it, unless a pop got there first
+    Node *expected = node;
+    return !slot.compare_exchange_strong(expected, nullptr,
+                                         std::memory_order_relaxed);
+  }
+
+  // pop side: takes a node a push left in a slot, or returns nullptr
+  Node *take() {
+    std::atomic<Node *> &slot = random_slot();
+    Node *node = slot.load(std::memory_order_acquire);
+    if (node && slot.compare_exchange_strong(node, nullptr,
+                                             std::memory_order_acquire))
+      return node;
+    return nullptr;
+  }
+};
+
+#endif  // LOCKFREE_STACK_H
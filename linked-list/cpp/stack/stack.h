@@ -7,31 +7,49 @@
  * @brief creates a simple stack class!
  */
 
-#include "../linked-list/linked_list.h"
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
-// Defines a stack that uses a doubly-linked list as a data structure.
+// Defines a stack that uses a vector as a data structure.
+// The top of the stack is the back of the vector, so push() and pop() are
+// amortized O(1) with no allocation per element.
 template <typename T>
 class Stack {
  public:
   // default constructor
-  Stack() : _ll{} {}
+  Stack() : _vec{} {}
   // list constructor
-  Stack(std::initializer_list<T> init_list) {
-    for (const std::string& val : init_list) this->_ll.push_front(val);
+  Stack(std::initializer_list<T> init_list) : _vec(init_list) {}
+  // pushes a value to the top of the stack
+  void push(const T& val) { this->_vec.push_back(val); }
+  void push(T&& val) { this->_vec.push_back(std::move(val)); }
+  // constructs a new top value in place from args
+  template <typename... Args>
+  T& emplace(Args&&... args) {
+    return this->_vec.emplace_back(std::forward<Args>(args)...);
   }
-  // pushes a string to the top of the stack
-  void push(T val) { this->_ll.push_front(val); }
   // pops off the top value in the stack
-  void pop() { this->_ll.pop_front(); }
+  void pop() {
+    if (this->_vec.empty()) throw std::domain_error("empty stack!");
+    this->_vec.pop_back();
+  }
   // returns the data at the top of the stack
-  T& top() { return this->_ll.front(); }
+  T& top() {
+    if (this->_vec.empty()) throw std::domain_error("empty stack!");
+    return this->_vec.back();
+  }
   // checks if the stack is empty (bool return value)
-  bool is_empty() { return this->_ll.empty(); }
+  bool is_empty() const { return this->_vec.empty(); }
   // returns the size of the stack
-  int size() { return this->_ll.size(); }
+  int size() const { return this->_vec.size(); }
+  // makes room for n values without growing again
+  void reserve(std::size_t n) { this->_vec.reserve(n); }
 
  private:
-  LinkedList<T> _ll;
+  std::vector<T> _vec;
 };
 
 #endif  // STACK_H